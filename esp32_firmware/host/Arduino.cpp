@@ -0,0 +1,40 @@
+#include <Arduino.h>
+#include <chrono>
+#include <random>
+#include <thread>
+
+HostSerial Serial;
+HostEsp ESP;
+
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+static std::mt19937 rng;
+
+unsigned long millis() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long micros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - startTime).count();
+}
+
+void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+long random(long low, long high) {
+    if (high <= low) {
+        return low;
+    }
+    return low + (long)(rng() % (unsigned long)(high - low));
+}
+
+void randomSeed(unsigned long seed) {
+    rng.seed(seed);
+}
+
+uint32_t esp_random() {
+    static std::random_device device;
+    return device();
+}
@@ -0,0 +1,84 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// The parts of the Arduino core the model code uses, for the native build
+// (pio run -e native). Flash and PSRAM are ordinary memory here, and
+// Serial writes to stdout.
+
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#define PROGMEM
+#define IRAM_ATTR
+
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_float(addr) (*(const float*)(addr))
+
+inline void* ps_malloc(size_t size) { return malloc(size); }
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+long random(long low, long high);
+void randomSeed(unsigned long seed);
+uint32_t esp_random();
+
+class String {
+public:
+    String(const char* text = "") : text(text ? text : "") {}
+
+    const char* c_str() const { return text.c_str(); }
+    unsigned int length() const { return text.size(); }
+    bool operator==(const String& other) const { return text == other.text; }
+    void toLowerCase() {
+        for (char& c : text) {
+            c = tolower((uint8_t)c);
+        }
+    }
+
+private:
+    std::string text;
+};
+
+class HostSerial {
+public:
+    void print(const char* text) { fputs(text, stdout); }
+    void print(const String& text) { print(text.c_str()); }
+    void print(char c) { putchar(c); }
+    void print(int value) { printf("%d", value); }
+    void print(unsigned int value) { printf("%u", value); }
+    void print(long value) { printf("%ld", value); }
+    void print(unsigned long value) { printf("%lu", value); }
+    void print(long long value) { printf("%lld", value); }
+    void print(unsigned long long value) { printf("%llu", value); }
+    void print(double value, int digits = 2) { printf("%.*f", digits, value); }
+
+    void println() { putchar('\n'); }
+    template <typename T>
+    void println(const T& value) {
+        print(value);
+        println();
+    }
+    void println(double value, int digits) {
+        print(value, digits);
+        println();
+    }
+};
+
+extern HostSerial Serial;
+
+class HostEsp {
+public:
+    uint32_t getFreeHeap() const { return 0; }  // Not tracked on the host
+};
+
+extern HostEsp ESP;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,35 @@
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+// NVS for the native build: nothing is kept between runs, so the kernel
+// settings are tuned on every start.
+
+#include <Arduino.h>
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false) {
+        (void)name;
+        (void)readOnly;
+        return true;
+    }
+    void end() {}
+
+    size_t getBytesLength(const char* key) {
+        (void)key;
+        return 0;
+    }
+    size_t getBytes(const char* key, void* buf, size_t maxLen) {
+        (void)key;
+        (void)buf;
+        (void)maxLen;
+        return 0;
+    }
+    size_t putBytes(const char* key, const void* value, size_t len) {
+        (void)key;
+        (void)value;
+        return len;
+    }
+};
+
+#endif // HOST_PREFERENCES_H
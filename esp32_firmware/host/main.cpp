@@ -0,0 +1,48 @@
+// Runs the model on the development machine (pio run -e native), without
+// WiFi or Bluesky: the weight tiling and container paths can be checked
+// and timed here before flashing.
+//
+//   .pio/build/native/program ["seed words"]
+//   .pio/build/native/program model.bin ["seed words"]   (MODEL_CONTAINER)
+
+#include <Arduino.h>
+#include "DogberryAI_Word.h"
+#include "KernelTuner.h"
+#ifdef MODEL_CONTAINER
+#include "ModelContainer.h"
+#endif
+
+int main(int argc, char** argv) {
+    int arg = 1;
+#ifdef MODEL_CONTAINER
+    if (argc <= arg) {
+        Serial.println("Usage: program model.bin [seed]");
+        return 1;
+    }
+    ModelContainer container;
+    if (!container.open(argv[arg++])) {
+        return 1;
+    }
+    container.printInfo();
+    DogberryAI_Word ai(container.weights());
+#else
+    DogberryAI_Word ai;
+#endif
+    const char* seed = argc > arg ? argv[arg] : "much ado about";
+
+    if (!ai.initialize()) {
+        Serial.println("ERROR: Failed to initialize AI model");
+        return 1;
+    }
+    KernelTuner tuner(ai);
+    tuner.begin();
+    ai.benchmarkStreaming();
+
+    randomSeed(esp_random());
+    GenerationConfig config;
+    String response = ai.generateResponse(seed, config);
+    Serial.print("Generated: ");
+    Serial.println(response);
+    ai.printStats();
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include "ActivationArena.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#endif
+
+static const char* const TIER_NAMES[TIER_COUNT] = {"SRAM", "PSRAM"};
+
+static size_t alignUp(size_t n) {
+    return (n + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+ActivationArena::ActivationArena() : count(0) {
+    for (int t = 0; t < TIER_COUNT; t++) {
+        raw[t] = nullptr;
+        blocks[t] = nullptr;
+        blockBytes[t] = 0;
+    }
+}
+
+ActivationArena::~ActivationArena() {
+    for (int t = 0; t < TIER_COUNT; t++) {
+        if (raw[t]) free(raw[t]);
+    }
+}
+
+int ActivationArena::reserve(const char* name, size_t bytes, MemoryTier tier, uint8_t lifetime) {
+    if (count >= ARENA_MAX_BUFFERS) {
+        Serial.println("Activation arena full");
+        return -1;
+    }
+    Buffer& b = buffers[count];
+    b.name = name;
+    b.bytes = bytes;
+    b.tier = tier;
+    b.lifetime = lifetime;
+    b.offset = 0;
+    return count++;
+}
+
+size_t ActivationArena::place(MemoryTier tier) {
+    // Largest first, so small buffers fill the gaps the big ones leave
+    int order[ARENA_MAX_BUFFERS];
+    int n = 0;
+    for (int i = 0; i < count; i++) {
+        if (buffers[i].tier != tier) {
+            continue;
+        }
+        int j = n++;
+        while (j > 0 && buffers[order[j - 1]].bytes < buffers[i].bytes) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    size_t end = 0;
+    for (int k = 0; k < n; k++) {
+        Buffer& b = buffers[order[k]];
+        size_t offset = 0;
+        bool moved = true;
+        while (moved) {
+            moved = false;
+            for (int p = 0; p < k; p++) {
+                const Buffer& placed = buffers[order[p]];
+                if ((placed.lifetime & b.lifetime) && offset < placed.offset + placed.bytes &&
+                    placed.offset < offset + b.bytes) {
+                    offset = alignUp(placed.offset + placed.bytes);
+                    moved = true;
+                }
+            }
+        }
+        b.offset = offset;
+        if (offset + b.bytes > end) {
+            end = offset + b.bytes;
+        }
+    }
+    return alignUp(end);
+}
+
+bool ActivationArena::allocateBlock(MemoryTier tier, size_t bytes) {
+#ifdef ESP_PLATFORM
+    uint32_t caps = tier == TIER_SRAM ? MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT : MALLOC_CAP_SPIRAM;
+    raw[tier] = heap_caps_aligned_alloc(ARENA_ALIGN, bytes, caps);
+    blocks[tier] = (uint8_t*)raw[tier];
+#else
+    raw[tier] = tier == TIER_SRAM ? malloc(bytes + ARENA_ALIGN) : ps_malloc(bytes + ARENA_ALIGN);
+    blocks[tier] = (uint8_t*)alignUp((uintptr_t)raw[tier]);
+#endif
+    if (!raw[tier]) {
+        return false;
+    }
+    memset(blocks[tier], 0, bytes);
+    blockBytes[tier] = bytes;
+    return true;
+}
+
+bool ActivationArena::allocate() {
+    size_t sram = place(TIER_SRAM);
+    if (sram > 0 && !allocateBlock(TIER_SRAM, sram)) {
+        Serial.println("Internal SRAM short, activation buffers moved to PSRAM");
+        for (int i = 0; i < count; i++) {
+            buffers[i].tier = TIER_PSRAM;
+        }
+    }
+    size_t psram = place(TIER_PSRAM);
+    if (psram > 0 && !allocateBlock(TIER_PSRAM, psram)) {
+        Serial.println("Failed to allocate activation arena");
+        return false;
+    }
+    return true;
+}
+
+void* ActivationArena::buffer(int id) const {
+    if (id < 0 || id >= count || !blocks[buffers[id].tier]) {
+        return nullptr;
+    }
+    return blocks[buffers[id].tier] + buffers[id].offset;
+}
+
+void ActivationArena::printMap() const {
+    Serial.println("Activation arena:");
+    size_t requested = 0;
+    for (int i = 0; i < count; i++) {
+        const Buffer& b = buffers[i];
+        char line[80];
+        snprintf(line, sizeof(line), "  %-16s %-5s +%-8u %8u bytes", b.name, TIER_NAMES[b.tier],
+                 (unsigned)b.offset, (unsigned)b.bytes);
+        Serial.println(line);
+        requested += b.bytes;
+    }
+    size_t total = blockBytes[TIER_SRAM] + blockBytes[TIER_PSRAM];
+    Serial.print("  SRAM ");
+    Serial.print(blockBytes[TIER_SRAM]);
+    Serial.print(" bytes, PSRAM ");
+    Serial.print(blockBytes[TIER_PSRAM]);
+    Serial.print(" bytes (");
+    Serial.print(requested > total ? requested - total : 0);
+    Serial.println(" saved by sharing)");
+}
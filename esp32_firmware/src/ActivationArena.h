@@ -0,0 +1,65 @@
+#ifndef ACTIVATION_ARENA_H
+#define ACTIVATION_ARENA_H
+
+#include <Arduino.h>
+
+// Every buffer starts on a cache line
+#define ARENA_ALIGN 64
+#define ARENA_MAX_BUFFERS 16
+
+// Where a buffer should live: small, hot buffers in internal SRAM, large
+// ones in PSRAM. SRAM buffers move to PSRAM if SRAM is short.
+enum MemoryTier { TIER_SRAM, TIER_PSRAM, TIER_COUNT };
+
+// When a buffer holds data that is still needed. Buffers whose lifetimes
+// don't intersect are given the same memory.
+#define LIFETIME_PROJECT 0x01  // Projecting a seed's inputs (projectInputs)
+#define LIFETIME_LSTM    0x02  // One LSTM step (feedTokens)
+#define LIFETIME_SAMPLE  0x04  // Drawing a token (sample)
+#define LIFETIME_ALWAYS  0xFF  // Model state, kept from step to step
+
+// All of a model's inference buffers, carved out of one block per tier:
+//
+//     int h = arena.reserve("lstm_h", bytes, TIER_SRAM, LIFETIME_ALWAYS);
+//     ...
+//     arena.allocate();
+//     float* lstm_h = (float*)arena.buffer(h);
+//
+// allocate() places the buffers largest first, each at the lowest aligned
+// offset that doesn't overlap a buffer it is live at the same time as.
+class ActivationArena {
+public:
+    ActivationArena();
+    ~ActivationArena();
+
+    // Returns the buffer's id, or -1 once ARENA_MAX_BUFFERS are reserved
+    int reserve(const char* name, size_t bytes, MemoryTier tier, uint8_t lifetime);
+
+    // Places and allocates everything reserved; false if even PSRAM is short
+    bool allocate();
+
+    void* buffer(int id) const;
+
+    // One line per buffer, then each tier's size and what sharing saved
+    void printMap() const;
+
+private:
+    struct Buffer {
+        const char* name;
+        size_t bytes;
+        MemoryTier tier;
+        uint8_t lifetime;
+        size_t offset;  // Within its tier's block
+    };
+
+    Buffer buffers[ARENA_MAX_BUFFERS];
+    int count;
+    void* raw[TIER_COUNT];  // As allocated, for freeing
+    uint8_t* blocks[TIER_COUNT];
+    size_t blockBytes[TIER_COUNT];
+
+    size_t place(MemoryTier tier);
+    bool allocateBlock(MemoryTier tier, size_t bytes);
+};
+
+#endif
@@ -1,7 +1,7 @@
 #include "BlueskyAPI.h"
 
-BlueskyAPI::BlueskyAPI(const char* handle, const char* appPassword)
-    : handle(handle), appPassword(appPassword) {}
+BlueskyAPI::BlueskyAPI(const char* handle, const char* appPassword, const char* apiBase)
+    : handle(handle), appPassword(appPassword), apiBase(apiBase) {}
 
 bool BlueskyAPI::authenticate() {
     Serial.println("Authenticating with Bluesky...");
@@ -14,7 +14,7 @@ bool BlueskyAPI::authenticate() {
     serializeJson(doc, body);
 
     JsonDocument response;
-    if (!makeRequest("https://bsky.social/xrpc/com.atproto.server.createSession",
+    if (!makeRequest(apiBase + "/com.atproto.server.createSession",
                      "POST", body, response)) {
         Serial.println("Authentication failed");
         return false;
@@ -27,81 +27,149 @@ bool BlueskyAPI::authenticate() {
     return true;
 }
 
-bool BlueskyAPI::postHasReplies(const String& uri) {
-    // Extract AT URI components: at://did/collection/rkey
-    String endpoint = "https://bsky.social/xrpc/app.bsky.feed.getPostThread?uri=" + uri;
-
-    JsonDocument response;
-    if (!makeRequest(endpoint, "GET", "", response)) {
-        Serial.println("Failed to fetch thread");
-        return false;  // Assume no replies if we can't fetch
+void BlueskyAPI::markSeen(const String& indexedAt) {
+    if (indexedAt.isEmpty() || indexedAt.compareTo(seenAt) <= 0) {
+        return;
     }
+    seenAt = indexedAt;
 
-    // Check if thread has replies
-    JsonObject thread = response["thread"];
-    if (!thread.isNull()) {
-        JsonArray replies = thread["replies"];
-        if (!replies.isNull() && replies.size() > 0) {
-            return true;  // Post has replies
-        }
-    }
+    JsonDocument doc;
+    doc["seenAt"] = indexedAt;
+    String body;
+    serializeJson(doc, body);
 
-    return false;  // No replies found
+    JsonDocument response;
+    if (!makeRequest(apiBase + "/app.bsky.notification.updateSeen", "POST", body, response)) {
+        Serial.println("Failed to mark notifications seen");
+    }
 }
 
-bool BlueskyAPI::checkMentions(String& mentionText, String& replyUri, String& replyCid) {
+int BlueskyAPI::checkMentions(Mention* mentions, int maxMentions) {
+    newestListed = "";
+    if (maxMentions <= 0) {
+        return 0;
+    }
     if (accessJwt.isEmpty()) {
         Serial.println("Not authenticated");
-        return false;
+        return 0;
     }
 
-    // Fetch only the 3 most recent mentions
-    String endpoint = "https://bsky.social/xrpc/app.bsky.notification.listNotifications?limit=3";
-
-    JsonDocument response;
-    if (!makeRequest(endpoint, "GET", "", response)) {
-        return false;
-    }
-
-    JsonArray notifications = response["notifications"];
-
-    // Iterate through mentions (newest first) and find the first one without replies
-    for (JsonObject notification : notifications) {
-        String reason = notification["reason"].as<String>();
-
-        // Skip if not a mention
-        if (reason != "mention") {
-            continue;
+    // Page back through the notifications, newest first, until reaching
+    // ones already seen. The read flag and timestamp come with the
+    // listing; indexedAt is ISO 8601 in UTC, so it compares as a string.
+    // Likes, follows and reposts fill pages too, hence the paging.
+    int found = 0;
+    bool overflowed = false;
+    String cursor;
+    for (int page = 0; page < MENTION_MAX_PAGES; page++) {
+        String endpoint = apiBase + "/app.bsky.notification.listNotifications?limit=" +
+                          String(MENTION_FETCH_LIMIT);
+        if (!cursor.isEmpty()) {
+            endpoint += "&cursor=" + cursor;
         }
 
-        String uri = notification["uri"].as<String>();
+        // A partial listing can't be marked seen without losing the rest,
+        // so it is dropped and the next poll starts over
+        JsonDocument response;
+        if (!makeRequest(endpoint, "GET", "", response)) {
+            newestListed = "";
+            return 0;
+        }
 
-        // Check if this post already has replies
-        if (postHasReplies(uri)) {
-            Serial.print("Skipping mention (already has replies): ");
-            Serial.println(uri);
-            continue;
+        bool reachedSeen = false;
+        JsonArray notifications = response["notifications"];
+        for (JsonObject notification : notifications) {
+            String indexedAt = notification["indexedAt"].as<String>();
+            if (newestListed.isEmpty()) {
+                newestListed = indexedAt;
+            }
+            if (notification["isRead"].as<bool>() ||
+                (!seenAt.isEmpty() && indexedAt.compareTo(seenAt) <= 0)) {
+                reachedSeen = true;
+                break;
+            }
+
+            // Skip anything but mentions and replies to the bot's posts
+            String reason = notification["reason"].as<String>();
+            if (reason != "mention" && reason != "reply") {
+                continue;
+            }
+
+            // Full: the newest mention so far makes room for this older one,
+            // so what is answered is always everything up to some point
+            if (found == maxMentions) {
+                for (int i = 1; i < found; i++) {
+                    mentions[i - 1] = mentions[i];
+                }
+                found--;
+                overflowed = true;
+            }
+
+            JsonObject record = notification["record"];
+            Mention& mention = mentions[found++];
+            mention.text = record["text"].as<String>();
+            mention.uri = notification["uri"].as<String>();
+            mention.cid = notification["cid"].as<String>();
+            mention.indexedAt = indexedAt;
+
+            JsonObject root = record["reply"]["root"];
+            if (root.isNull()) {
+                mention.rootUri = mention.uri;
+                mention.rootCid = mention.cid;
+            } else {
+                mention.rootUri = root["uri"].as<String>();
+                mention.rootCid = root["cid"].as<String>();
+            }
         }
 
-        // Found a mention without replies - this is the one to respond to
-        JsonObject record = notification["record"];
-        mentionText = record["text"].as<String>();
-        replyUri = uri;
-        replyCid = notification["cid"].as<String>();
+        const char* next = response["cursor"];
+        if (reachedSeen || !next || !*next) {
+            break;
+        }
+        cursor = next;
+        if (page == MENTION_MAX_PAGES - 1) {
+            Serial.println("Unseen notifications go back further than this poll reads");
+        }
+    }
 
-        Serial.print("Found new mention without replies: ");
-        Serial.println(mentionText);
-        return true;
+    // Oldest first, so each batch answered can be marked seen in turn
+    for (int i = 0, j = found - 1; i < j; i++, j--) {
+        Mention swap = mentions[i];
+        mentions[i] = mentions[j];
+        mentions[j] = swap;
     }
+    if (overflowed) {
+        newestListed = mentions[found - 1].indexedAt;
+        Serial.println("More mentions than one poll takes; the newest wait for the next");
+    }
+    for (int i = 0; i < found; i++) {
+        Serial.print("Found new mention: ");
+        Serial.println(mentions[i].text);
+    }
+    return found;
+}
 
-    return false;  // No unreplied mentions found
+bool BlueskyAPI::fitsPostLimit(const String& text) {
+    // Checked before uploading, rather than finding out from a rejected
+    // request
+    int graphemes = ResponseBuilder::countGraphemes(text.c_str(), text.length());
+    if (graphemes > MAX_POST_GRAPHEMES) {
+        Serial.print("Post too long: ");
+        Serial.print(graphemes);
+        Serial.println(" graphemes");
+        return false;
+    }
+    return true;
 }
 
-bool BlueskyAPI::postReply(const String& text, const String& replyUri, const String& replyCid) {
+bool BlueskyAPI::postReply(const String& text, const Mention& mention) {
     if (accessJwt.isEmpty()) {
         Serial.println("Not authenticated");
         return false;
     }
+    if (!fitsPostLimit(text)) {
+        return false;
+    }
 
     JsonDocument doc;
     doc["repo"] = did;
@@ -113,18 +181,18 @@ bool BlueskyAPI::postReply(const String& text, const String& replyUri, const Str
 
     JsonObject reply = record["reply"].to<JsonObject>();
     JsonObject parent = reply["parent"].to<JsonObject>();
-    parent["uri"] = replyUri;
-    parent["cid"] = replyCid;
+    parent["uri"] = mention.uri;
+    parent["cid"] = mention.cid;
 
     JsonObject root = reply["root"].to<JsonObject>();
-    root["uri"] = replyUri;
-    root["cid"] = replyCid;
+    root["uri"] = mention.rootUri;
+    root["cid"] = mention.rootCid;
 
     String body;
     serializeJson(doc, body);
 
     JsonDocument response;
-    if (!makeRequest("https://bsky.social/xrpc/com.atproto.repo.createRecord",
+    if (!makeRequest(apiBase + "/com.atproto.repo.createRecord",
                      "POST", body, response)) {
         Serial.println("Failed to post reply");
         return false;
@@ -139,6 +207,9 @@ bool BlueskyAPI::postStatus(const String& text) {
         Serial.println("Not authenticated");
         return false;
     }
+    if (!fitsPostLimit(text)) {
+        return false;
+    }
 
     JsonDocument doc;
     doc["repo"] = did;
@@ -152,7 +223,7 @@ bool BlueskyAPI::postStatus(const String& text) {
     serializeJson(doc, body);
 
     JsonDocument response;
-    if (!makeRequest("https://bsky.social/xrpc/com.atproto.repo.createRecord",
+    if (!makeRequest(apiBase + "/com.atproto.repo.createRecord",
                      "POST", body, response)) {
         Serial.println("Failed to post status");
         return false;
@@ -186,7 +257,12 @@ bool BlueskyAPI::makeRequest(const String& endpoint, const String& method,
         return false;
     }
 
+    // Some procedures (updateSeen) answer with an empty body
     String payload = http.getString();
+    if (payload.isEmpty()) {
+        http.end();
+        return true;
+    }
     DeserializationError error = deserializeJson(response, payload);
 
     if (error) {
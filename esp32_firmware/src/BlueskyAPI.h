@@ -4,23 +4,63 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <HTTPClient.h>
+#include "ResponseBuilder.h"
+
+// XRPC endpoint of the PDS; pass another base (e.g. tools/mock_bluesky.py)
+// to the constructor for testing
+#define BLUESKY_DEFAULT_API_BASE "https://bsky.social/xrpc"
+
+// Notifications per page of listNotifications, and the most mentions a
+// poll returns; a poll pages back until it reaches notifications already
+// seen, or MENTION_MAX_PAGES
+#define MENTION_FETCH_LIMIT 30
+#define MENTION_MAX_PAGES 8
+
+// A mention (or a reply to one of the bot's posts) waiting for a reply
+struct Mention {
+    String text;
+    String uri;
+    String cid;
+    String rootUri;  // Thread root; the post itself if it starts the thread
+    String rootCid;
+    String indexedAt;  // When the server received it; what markSeen() takes
+};
 
 class BlueskyAPI {
 public:
-    BlueskyAPI(const char* handle, const char* appPassword);
+    BlueskyAPI(const char* handle, const char* appPassword,
+               const char* apiBase = BLUESKY_DEFAULT_API_BASE);
 
     bool authenticate();
-    bool checkMentions(String& mentionText, String& replyUri, String& replyCid);
-    bool postReply(const String& text, const String& replyUri, const String& replyCid);
+
+    // Fills mentions with up to maxMentions mentions newer than the last
+    // one marked seen, oldest first; returns how many were found. If there
+    // are more, the newest are left for the next poll. Returns 0 if the
+    // listing fails part way.
+    int checkMentions(Mention* mentions, int maxMentions);
+
+    // Everything up to and including indexedAt has been dealt with, here
+    // and (through updateSeen) on the server, so neither a later poll nor
+    // a restart returns it again. Never moves backwards.
+    void markSeen(const String& indexedAt);
+
+    // Newest notification the last checkMentions() covered, mentions or
+    // not; mark it seen once all of that poll's mentions are answered
+    const String& listedUntil() const { return newestListed; }
+
+    bool postReply(const String& text, const Mention& mention);
     bool postStatus(const String& text);
 
 private:
     const char* handle;
     const char* appPassword;
+    String apiBase;
     String accessJwt;
     String did;
+    String seenAt;  // indexedAt of the newest notification marked seen
+    String newestListed;
 
-    bool postHasReplies(const String& uri);
+    bool fitsPostLimit(const String& text);
 
     bool makeRequest(const String& endpoint, const String& method,
                      const String& body, JsonDocument& response);
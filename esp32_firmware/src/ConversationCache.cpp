@@ -0,0 +1,107 @@
+#include "ConversationCache.h"
+#include <cmath>
+
+ConversationCache::ConversationCache()
+    : keys(nullptr), entries(nullptr), used(0), clock(0) {}
+
+ConversationCache::~ConversationCache() {
+    if (keys) free(keys);
+    if (entries) free(entries);
+}
+
+bool ConversationCache::begin() {
+    keys = (uint64_t*)ps_malloc(CONVERSATION_CACHE_SIZE * sizeof(uint64_t));
+    entries = (Entry*)ps_malloc(CONVERSATION_CACHE_SIZE * sizeof(Entry));
+    if (!keys || !entries) {
+        Serial.println("Failed to allocate conversation cache");
+        return false;
+    }
+    memset(keys, 0, CONVERSATION_CACHE_SIZE * sizeof(uint64_t));
+    return true;
+}
+
+uint64_t ConversationCache::keyFor(const char* threadId) {
+    // FNV-1a; 0 marks an empty slot, so it is never returned
+    uint64_t hash = 14695981039346656037ull;
+    for (const char* p = threadId; *p; p++) {
+        hash ^= (uint8_t)*p;
+        hash *= 1099511628211ull;
+    }
+    return hash ? hash : 1;
+}
+
+int ConversationCache::find(uint64_t key) const {
+    for (int i = 0; i < used; i++) {
+        if (keys[i] == key) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Symmetric int8 quantization of one state vector; returns the scale
+static float quantize(const float* values, int n, int8_t* out) {
+    float maxAbs = 0.0f;
+    for (int i = 0; i < n; i++) {
+        maxAbs = fmaxf(maxAbs, fabsf(values[i]));
+    }
+    float scale = maxAbs > 0.0f ? maxAbs / 127.0f : 1.0f;
+    for (int i = 0; i < n; i++) {
+        out[i] = (int8_t)lroundf(values[i] / scale);
+    }
+    return scale;
+}
+
+static void dequantize(const int8_t* values, int n, float scale, float* out) {
+    for (int i = 0; i < n; i++) {
+        out[i] = values[i] * scale;
+    }
+}
+
+bool ConversationCache::load(uint64_t key, int units, float* h, float* c, int* lastToken) {
+    if (!entries) {
+        return false;
+    }
+    int i = find(key);
+    if (i < 0 || entries[i].units != units) {
+        return false;
+    }
+
+    Entry& entry = entries[i];
+    entry.lastUsed = ++clock;
+    dequantize(entry.h, units, entry.hScale, h);
+    dequantize(entry.c, units, entry.cScale, c);
+    *lastToken = entry.lastToken;
+    return true;
+}
+
+void ConversationCache::store(uint64_t key, int units, const float* h, const float* c,
+                              int lastToken) {
+    if (!entries) {
+        return;
+    }
+
+    // Overwrite the thread's own entry, else take a free one, else the
+    // least recently used
+    int i = find(key);
+    if (i < 0) {
+        if (used < CONVERSATION_CACHE_SIZE) {
+            i = used++;
+        } else {
+            i = 0;
+            for (int j = 1; j < CONVERSATION_CACHE_SIZE; j++) {
+                if (entries[j].lastUsed < entries[i].lastUsed) {
+                    i = j;
+                }
+            }
+        }
+        keys[i] = key;
+    }
+
+    Entry& entry = entries[i];
+    entry.lastUsed = ++clock;
+    entry.lastToken = (int16_t)lastToken;
+    entry.units = (int16_t)units;
+    entry.hScale = quantize(h, units, entry.h);
+    entry.cScale = quantize(c, units, entry.c);
+}
@@ -0,0 +1,54 @@
+#ifndef CONVERSATION_CACHE_H
+#define CONVERSATION_CACHE_H
+
+#include <Arduino.h>
+#include "DogberryAI_Word.h"
+
+// Threads whose LSTM state is remembered
+#define CONVERSATION_CACHE_SIZE 2048
+
+// The LSTM state each conversation ended in, so a reply to one of the
+// bot's replies continues from there instead of from a fresh seed.
+// Entries are keyed by a 64-bit hash of the thread's root URI and hold
+// h and c quantized to int8 with one scale per vector (about 530 bytes
+// each, all in PSRAM). When full, the least recently used thread is
+// replaced. The state belongs to the model that produced it: a model with
+// a different number of units doesn't find it.
+class ConversationCache {
+public:
+    ConversationCache();
+    ~ConversationCache();
+
+    // Allocates the entries; returns false if PSRAM is short
+    bool begin();
+
+    static uint64_t keyFor(const char* threadId);
+
+    // Restores the state saved for key into h and c. lastToken receives
+    // the token the response ended on, which was never fed to the LSTM
+    // (-1 if none).
+    bool load(uint64_t key, int units, float* h, float* c, int* lastToken);
+    void store(uint64_t key, int units, const float* h, const float* c, int lastToken);
+
+    int size() const { return used; }
+
+private:
+    struct Entry {
+        uint32_t lastUsed;
+        int16_t lastToken;
+        int16_t units;  // Of the model the state is from
+        float hScale;
+        float cScale;
+        int8_t h[LSTM_UNITS];
+        int8_t c[LSTM_UNITS];
+    };
+
+    uint64_t* keys;   // Kept apart from the entries so lookups scan 8 bytes each; 0 = empty
+    Entry* entries;
+    int used;
+    uint32_t clock;
+
+    int find(uint64_t key) const;
+};
+
+#endif
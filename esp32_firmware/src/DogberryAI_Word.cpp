@@ -1,203 +1,1022 @@
 #include "DogberryAI_Word.h"
-#include "model_weights_word.h"
-#include "vocab_data_word.h"
+#include "ResponseGenerator.h"
+#include "vocab_pool_word.h"
 #include <cmath>
 #include <cstring>
 
-DogberryAI_Word::DogberryAI_Word() {
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#include "soc/soc_memory_layout.h"
+#endif
+
+// Container builds leave the full model's weights out of the image
+#ifndef MODEL_CONTAINER
+#include "model_weights_word.h"
+
+// Models exported by tools/prune_vocab.py record their vocabulary size
+#ifdef MODEL_VOCAB_SIZE
+static_assert(MODEL_VOCAB_SIZE == VOCAB_COUNT, "model_weights_word.h does not match the vocabulary");
+#endif
+#endif
+
+// Product-quantized embeddings for the full model, if generated
+#if !defined(MODEL_CONTAINER) && __has_include("model_embedding_pq.h")
+#include "model_embedding_pq.h"
+#define HAVE_EMBEDDING_PQ
+static_assert(EMBEDDING_DIM % EMBEDDING_PQ_SUBSPACES == 0, "PQ subspaces must divide EMBEDDING_DIM");
+static_assert(sizeof(EMBEDDING_PQ_CODES) == VOCAB_COUNT * EMBEDDING_PQ_SUBSPACES,
+              "model_embedding_pq.h does not match the vocabulary");
+#endif
+
+// The fast model of the cascade, if it was exported alongside
+#if __has_include("model_weights_small.h")
+#include "model_weights_small.h"
+#define HAVE_FAST_MODEL
+static_assert(SMALL_LSTM_UNITS <= LSTM_UNITS, "model_weights_small.h is larger than LSTM_UNITS");
+static_assert(SMALL_LSTM_UNITS % LSTM_UNITS_MULTIPLE == 0,
+              "SMALL_LSTM_UNITS must be a multiple of LSTM_UNITS_MULTIPLE");
+// It shares the full model's vocabulary, so a stale export after
+// prune_vocab.py would read the wrong dense stride and token ids
+static_assert(sizeof(SMALL_DENSE_BIAS) / sizeof(float) == VOCAB_COUNT,
+              "model_weights_small.h does not match the vocabulary");
+#endif
+
+const ModelWeights* DogberryAI_Word::fullModel() {
+#ifdef MODEL_CONTAINER
+    return nullptr;
+#else
+    // With PQ embeddings EMBEDDING_WEIGHTS is left unreferenced, so the
+    // linker drops it from flash
+    static const ModelWeights weights = {
+#ifdef HAVE_EMBEDDING_PQ
+        "full", LSTM_UNITS, nullptr, LSTM_KERNEL, LSTM_RECURRENT, LSTM_BIAS, DENSE_KERNEL, DENSE_BIAS,
+        EMBEDDING_PQ_SUBSPACES, EMBEDDING_PQ_CENTROIDS, EMBEDDING_PQ_CODES, EMBEDDING_PQ_CODEBOOK,
+#else
+        "full", LSTM_UNITS, EMBEDDING_WEIGHTS, LSTM_KERNEL, LSTM_RECURRENT, LSTM_BIAS,
+        DENSE_KERNEL, DENSE_BIAS, 0, 0, nullptr, nullptr,
+#endif
+        VOCAB_COUNT, VOCAB_POOL, VOCAB_OFFSETS, VOCAB_SORTED, nullptr, nullptr,
+    };
+    return &weights;
+#endif
+}
+
+const ModelWeights* DogberryAI_Word::fastModel() {
+#ifdef HAVE_FAST_MODEL
+    static const ModelWeights weights = {
+        "fast", SMALL_LSTM_UNITS, SMALL_EMBEDDING_WEIGHTS, SMALL_LSTM_KERNEL, SMALL_LSTM_RECURRENT,
+        SMALL_LSTM_BIAS, SMALL_DENSE_KERNEL, SMALL_DENSE_BIAS, 0, 0, nullptr, nullptr,
+        VOCAB_COUNT, VOCAB_POOL, VOCAB_OFFSETS, VOCAB_SORTED, nullptr, nullptr,
+    };
+    return &weights;
+#else
+    return nullptr;
+#endif
+}
+
+DogberryAI_Word::DogberryAI_Word(const ModelWeights* weights) {
+    model = weights;
+    units = weights->units;
+    fused_cols = LSTM_FUSED_COLS(units);
     embedding_output = nullptr;
     lstm_h = nullptr;
     lstm_c = nullptr;
-    lstm_output = nullptr;
     logits = nullptr;
     probs = nullptr;
-    lstm_gates = nullptr;
+    lstm_fused = nullptr;
+    lstm_fused_bias = nullptr;
+    pq_codebook = nullptr;
+    memset(h_parity, 0, sizeof(h_parity));
+    prefill_inputs = nullptr;
+    project_scratch = nullptr;
+    vocab_size = weights->vocabCount;
+    last_logprob = 0.0f;
+    dense_psram = nullptr;
+    sparsity_threshold = DEFAULT_SPARSITY_THRESHOLD;
+    prefix_count = 0;
+    active_generator = nullptr;
+    token_cost_us = INITIAL_TOKEN_COST_US;
+    sentence_tokens = INITIAL_SENTENCE_TOKENS;
+    token_cost_timed = false;
 }
 
 DogberryAI_Word::~DogberryAI_Word() {
-    if (embedding_output) free(embedding_output);
-    if (lstm_h) free(lstm_h);
-    if (lstm_c) free(lstm_c);
-    if (lstm_output) free(lstm_output);
-    if (logits) free(logits);
-    if (probs) free(probs);
-    if (lstm_gates) free(lstm_gates);
+    if (lstm_fused && lstm_fused != model->lstmFused) free((void*)lstm_fused);
+    if (lstm_fused_bias && lstm_fused_bias != model->lstmFusedBias) free((void*)lstm_fused_bias);
+    if (dense_psram) free(dense_psram);
+    for (int i = 0; i < prefix_count; i++) {
+        free(prefix_cache[i].h);
+    }
 }
 
 bool DogberryAI_Word::initialize() {
     Serial.println("Initializing DogberryAI (Word-level)...");
 
-    // Allocate buffers in PSRAM
-    embedding_output = (float*)ps_malloc(EMBEDDING_DIM * sizeof(float));
-    lstm_h = (float*)ps_malloc(LSTM_UNITS * sizeof(float));
-    lstm_c = (float*)ps_malloc(LSTM_UNITS * sizeof(float));
-    lstm_output = (float*)ps_malloc(LSTM_UNITS * sizeof(float));
-    logits = (float*)ps_malloc(VOCAB_SIZE * sizeof(float));
-    probs = (float*)ps_malloc(VOCAB_SIZE * sizeof(float));
-    lstm_gates = (float*)ps_malloc(LSTM_UNITS * 4 * sizeof(float));
+    // Compiled-in models are checked when built; a loaded one may not fit
+    if (units <= 0 || units > LSTM_UNITS || units % LSTM_UNITS_MULTIPLE != 0 ||
+        vocab_size <= TOKEN_START || vocab_size > MAX_VOCAB_SIZE ||
+        (!model->embedding && model->pqSubspaces <= 0) ||
+        (!model->lstmRecurrent && !model->lstmFused)) {
+        Serial.println("Model does not fit this build or is missing weights");
+        return false;
+    }
 
-    if (!embedding_output || !lstm_h || !lstm_c || !lstm_output || !logits || !probs || !lstm_gates) {
+    // Reserve the inference buffers, one row per batch slot. Buffers only
+    // needed in one phase of a step share memory with those of the others.
+    int h = arena.reserve("lstm_h", 2 * MAX_BATCH * units * sizeof(float), TIER_SRAM,
+                          LIFETIME_ALWAYS);
+    int c = arena.reserve("lstm_c", MAX_BATCH * units * sizeof(float), TIER_SRAM, LIFETIME_ALWAYS);
+    int emb = arena.reserve("embedding_output", MAX_BATCH * EMBEDDING_DIM * sizeof(float),
+                            TIER_SRAM, LIFETIME_LSTM);
+    int p = arena.reserve("probs", vocab_size * sizeof(float), TIER_SRAM, LIFETIME_SAMPLE);
+    int x = arena.reserve("project_scratch", EMBEDDING_DIM * SEQ_LENGTH * sizeof(float),
+                          TIER_SRAM, LIFETIME_PROJECT);
+    int cb = -1;
+    if (model->pqSubspaces > 0) {
+        cb = arena.reserve("pq_codebook", EMBEDDING_DIM * model->pqCentroids * sizeof(float),
+                           TIER_SRAM, LIFETIME_ALWAYS);
+    }
+    int lg = arena.reserve("logits", MAX_BATCH * vocab_size * sizeof(float), TIER_PSRAM,
+                           LIFETIME_ALWAYS);
+    int pf = arena.reserve("prefill_inputs", MAX_BATCH * SEQ_LENGTH * units * 4 * sizeof(float),
+                           TIER_PSRAM, LIFETIME_ALWAYS);
+    if (!arena.allocate()) {
         Serial.println("Failed to allocate model buffers");
         return false;
     }
+    lstm_h = (float*)arena.buffer(h);
+    lstm_c = (float*)arena.buffer(c);
+    embedding_output = (float*)arena.buffer(emb);
+    probs = (float*)arena.buffer(p);
+    project_scratch = (float*)arena.buffer(x);
+    pq_codebook = cb >= 0 ? (float*)arena.buffer(cb) : nullptr;
+    logits = (float*)arena.buffer(lg);
+    prefill_inputs = (float*)arena.buffer(pf);
+    arena.printMap();
 
-    // Initialize LSTM state to zero
-    memset(lstm_h, 0, LSTM_UNITS * sizeof(float));
-    memset(lstm_c, 0, LSTM_UNITS * sizeof(float));
+    if (!packLstmWeights()) {
+        return false;
+    }
+    if (model->pqSubspaces > 0 && !loadCodebook()) {
+        return false;
+    }
+    weight_stream.begin();
 
+    // The arena is zeroed, so the LSTM state starts at zero
     Serial.println("DogberryAI initialized successfully");
     return true;
 }
 
 String DogberryAI_Word::generateResponse(const String& seedText, int maxWords) {
-    Serial.println("Generating response...");
+    GenerationConfig config;
+    config.maxWords = maxWords;
+    return generateResponse(seedText, config);
+}
 
-    // Tokenize seed text
-    int seed_tokens[SEQ_LENGTH];
-    int seed_len = 0;
+String DogberryAI_Word::generateResponse(const String& seedText, const GenerationConfig& config) {
+    char buffer[RESPONSE_BUFFER_SIZE];
+    generateResponse(seedText.c_str(), config, buffer, sizeof(buffer));
+    return String(buffer);
+}
 
-    // Split by spaces
-    String word = "";
-    for (unsigned int i = 0; i < seedText.length() && seed_len < SEQ_LENGTH; i++) {
-        char c = seedText.charAt(i);
-        if (c == ' ' || c == '\n' || c == '\t') {
-            if (word.length() > 0) {
-                seed_tokens[seed_len++] = tokenizeWord(word);
-                word = "";
-            }
-        } else {
-            word += c;
+int DogberryAI_Word::generateResponse(const char* seedText, const GenerationConfig& config,
+                                      char* out, int outSize) {
+    return generateResponse(seedText, config, nullptr, nullptr, out, outSize);
+}
+
+int DogberryAI_Word::generateResponse(const char* seedText, const GenerationConfig& config,
+                                      TokenCallback onToken, void* context,
+                                      char* out, int outSize) {
+    // Blocking wrapper: run the incremental generator to completion
+    ResponseGenerator generator(*this);
+    if (!generator.begin(seedText, config, out, outSize, onToken, context)) {
+        if (outSize > 0) {
+            out[0] = '\0';
         }
+        return 0;
     }
-    if (word.length() > 0 && seed_len < SEQ_LENGTH) {
-        seed_tokens[seed_len++] = tokenizeWord(word);
+    while (!generator.step(SEQ_LENGTH)) {
     }
+    return generator.resultLength();
+}
 
-    // Pad with zeros if needed
-    for (int i = seed_len; i < SEQ_LENGTH; i++) {
-        seed_tokens[i] = 0;
+// Compares a word, folded to lowercase on the fly, with a vocabulary entry
+static int compareFolded(const char* word, int len, const char* entry) {
+    for (int i = 0; i < len; i++) {
+        uint8_t a = (uint8_t)tolower((uint8_t)word[i]);
+        uint8_t b = (uint8_t)entry[i];
+        if (a != b) {
+            return a < b ? -1 : 1;  // Also covers the entry ending early (b == 0)
+        }
     }
+    return entry[len] == '\0' ? 0 : -1;
+}
 
-    // Reset LSTM state
-    memset(lstm_h, 0, LSTM_UNITS * sizeof(float));
-    memset(lstm_c, 0, LSTM_UNITS * sizeof(float));
+int DogberryAI_Word::tokenizeWord(const char* word, int len) {
+    // Binary search over the ids sorted by word (vocab_index_word.h)
+    int lo = 0;
+    int hi = vocab_size - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) >> 1;
+        int idx = pgm_read_word(&model->vocabSorted[mid]);
+        int cmp = compareFolded(word, len, detokenizeWord(idx).data);
+        if (cmp == 0) {
+            return idx;
+        }
+        if (cmp < 0) {
+            hi = mid - 1;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return 1; // <UNK>
+}
 
-    // Process seed sequence
-    for (int i = 0; i < seed_len; i++) {
-        embedding(seed_tokens[i], embedding_output);
-        lstm_step(embedding_output, lstm_h, lstm_c, lstm_output);
+// True if a URL starts at p (http://, https:// or www.)
+static bool startsWithUrl(const uint8_t* p) {
+    static const char* const prefixes[] = {"http://", "https://", "www."};
+    for (const char* prefix : prefixes) {
+        int i = 0;
+        while (prefix[i] && tolower(p[i]) == prefix[i]) {
+            i++;
+        }
+        if (!prefix[i]) {
+            return true;
+        }
     }
+    return false;
+}
 
-    // Generate new words
-    String response = "";
-    for (int i = 0; i < maxWords; i++) {
-        dense(lstm_output, logits);
-        int next_word_idx = sample(logits, 0.8);
+int DogberryAI_Word::tokenizeText(const char* text, int* tokens, int maxTokens) {
+    // Single pass over the UTF-8 text, matching the training tokenizer:
+    // words are lowercased runs of letters and digits, punctuation that
+    // has its own vocabulary entry becomes a token, and everything else
+    // (apostrophes, quotes, symbols, emoji) only separates words.
+    // Mentions and URLs are dropped. The current word is built in a small
+    // stack buffer, so nothing is allocated.
+    char word[MAX_WORD_BYTES];
+    int wordLen = 0;
+    bool wordTooLong = false;
+    int count = 0;
+
+    auto flushWord = [&]() {
+        if (wordLen > 0 && count < maxTokens) {
+            tokens[count++] = wordTooLong ? TOKEN_UNK : tokenizeWord(word, wordLen);
+        }
+        wordLen = 0;
+        wordTooLong = false;
+    };
+    auto appendByte = [&](uint8_t b) {
+        if (wordLen < MAX_WORD_BYTES) {
+            word[wordLen++] = (char)b;
+        } else {
+            wordTooLong = true;
+        }
+    };
 
-        String next_word = detokenizeWord(next_word_idx);
+    const uint8_t* p = (const uint8_t*)text;
+    while (*p && count < maxTokens) {
+        uint8_t c = *p;
 
-        // Stop on special tokens or period
-        if (next_word == "<PAD>" || next_word == "<UNK>" || next_word == "<START>") {
+        if (wordLen == 0 && (c == '@' || startsWithUrl(p))) {
+            while (*p && !isspace(*p)) {
+                p++;
+            }
             continue;
         }
-        if (next_word == ".") {
-            response += ".";
-            break;
+
+        if (c < 0x80) {
+            if (isalnum(c)) {
+                appendByte(tolower(c));
+            } else {
+                flushWord();
+                if (ispunct(c) && count < maxTokens) {
+                    char punct = (char)c;
+                    int idx = tokenizeWord(&punct, 1);
+                    if (idx != TOKEN_UNK) {
+                        tokens[count++] = idx;
+                    }
+                }
+            }
+            p++;
+            continue;
         }
 
-        if (response.length() > 0) {
-            response += " ";
+        // Multi-byte sequence: decode it, treating malformed input as a separator
+        int n = (c & 0xE0) == 0xC0 ? 2 : (c & 0xF0) == 0xE0 ? 3 : (c & 0xF8) == 0xF0 ? 4 : 1;
+        uint32_t cp = n == 2 ? (c & 0x1F) : n == 3 ? (c & 0x0F) : (c & 0x07);
+        for (int i = 1; i < n; i++) {
+            if ((p[i] & 0xC0) != 0x80) {
+                n = 1;
+                break;
+            }
+            cp = (cp << 6) | (p[i] & 0x3F);
         }
-        response += next_word;
 
-        // Continue LSTM
-        embedding(next_word_idx, embedding_output);
-        lstm_step(embedding_output, lstm_h, lstm_c, lstm_output);
+        // Latin letters (Latin-1 Supplement and Extended-A/B) are part of
+        // words; Latin-1 capitals are folded to lowercase
+        if (n == 2 && cp >= 0xC0 && cp <= 0x24F && cp != 0xD7 && cp != 0xF7) {
+            if (cp <= 0xDE) {
+                cp += 0x20;
+            }
+            appendByte(0xC0 | (cp >> 6));
+            appendByte(0x80 | (cp & 0x3F));
+        } else {
+            flushWord();
+        }
+        p += n;
     }
+    flushWord();
 
-    cleanResponse(response);
-    return response;
+    return count;
 }
 
-int DogberryAI_Word::tokenizeWord(const String& word) {
-    String lower = word;
-    lower.toLowerCase();
+bool DogberryAI_Word::testTokenizer() {
+    // Every entry must map back to its own id, in any letter case. The
+    // special tokens (<PAD>, <UNK>, <START>) are not reachable from text.
+    int failures = 0;
+    char upper[64];
+    for (int i = 3; i < vocab_size; i++) {
+        WordView view = detokenizeWord(i);
+        const char* word = view.data;
+        int len = view.length;
+        for (int j = 0; j <= len && j < (int)sizeof(upper); j++) {
+            upper[j] = toupper((uint8_t)word[j]);
+        }
+        if (tokenizeWord(word, len) != i || tokenizeWord(upper, len) != i) {
+            Serial.print("Tokenizer round trip failed: ");
+            Serial.println(word);
+            failures++;
+        }
+    }
 
-    for (int i = 0; i < VOCAB_SIZE; i++) {
-        if (lower == String(VOCAB_WORDS[i])) {
-            return i;
+    Serial.print("Tokenizer round trip: ");
+    Serial.print(vocab_size - 3 - failures);
+    Serial.print("/");
+    Serial.print(vocab_size - 3);
+    Serial.println(" ok");
+    return failures == 0;
+}
+
+void DogberryAI_Word::benchmarkTokenizer() {
+    // Looks up every vocabulary word with the old linear String scan and
+    // with the sorted index
+    const int step = 8;  // The linear scan is slow; sample every 8th word
+    int checksum = 0;
+
+    unsigned long start = micros();
+    for (int i = 0; i < vocab_size; i += step) {
+        String lower = String(detokenizeWord(i).data);
+        lower.toLowerCase();
+        for (int j = 0; j < vocab_size; j++) {
+            if (lower == String(detokenizeWord(j).data)) {
+                checksum += j;
+                break;
+            }
         }
     }
-    return 1; // <UNK>
+    unsigned long linearUs = micros() - start;
+
+    start = micros();
+    for (int i = 0; i < vocab_size; i += step) {
+        WordView view = detokenizeWord(i);
+        checksum += tokenizeWord(view.data, view.length);
+    }
+    unsigned long indexedUs = micros() - start;
+
+    int lookups = (vocab_size + step - 1) / step;
+    Serial.print("tokenizeWord: linear ");
+    Serial.print((float)linearUs / lookups, 2);
+    Serial.print(" us/lookup, indexed ");
+    Serial.print((float)indexedUs / lookups, 2);
+    Serial.print(" us/lookup (checksum ");
+    Serial.print(checksum);
+    Serial.println(")");
+}
+
+void DogberryAI_Word::benchmarkBatch() {
+    // Generates MAX_BATCH responses one after another, then the same number
+    // as one batch. There is no stop token or deadline, so both runs do the
+    // same work apart from restarted attempts.
+    char* block = (char*)ps_malloc(MAX_BATCH * RESPONSE_BUFFER_SIZE);
+    if (!block) {
+        Serial.println("Failed to allocate benchmark buffers");
+        return;
+    }
+    const char* seeds[MAX_BATCH];
+    char* outs[MAX_BATCH];
+    for (int b = 0; b < MAX_BATCH; b++) {
+        seeds[b] = "marry i say";
+        outs[b] = block + b * RESPONSE_BUFFER_SIZE;
+    }
+
+    GenerationConfig config;
+    config.maxWords = 20;
+    config.stopTokens[0] = nullptr;
+
+    ResponseGenerator generator(*this);
+    unsigned long start = micros();
+    uint32_t tokensBefore = stats.tokensSampled;
+    for (int b = 0; b < MAX_BATCH; b++) {
+        if (!generator.begin(seeds[b], config, outs[b], RESPONSE_BUFFER_SIZE)) {
+            free(block);
+            return;
+        }
+        while (!generator.step(SEQ_LENGTH)) {}
+    }
+    unsigned long sequentialUs = micros() - start;
+    uint32_t sequentialTokens = stats.tokensSampled - tokensBefore;
+
+    start = micros();
+    tokensBefore = stats.tokensSampled;
+    if (generator.beginBatch(seeds, MAX_BATCH, config, outs, RESPONSE_BUFFER_SIZE)) {
+        while (!generator.step(SEQ_LENGTH)) {}
+    }
+    unsigned long batchedUs = micros() - start;
+    uint32_t batchedTokens = stats.tokensSampled - tokensBefore;
+    free(block);
+
+    Serial.print(MAX_BATCH);
+    Serial.print(" responses: sequential ");
+    Serial.print(sequentialUs / 1000);
+    Serial.print(" ms (");
+    Serial.print(sequentialTokens * 1e6f / sequentialUs, 1);
+    Serial.print(" tokens/s), batched ");
+    Serial.print(batchedUs / 1000);
+    Serial.print(" ms (");
+    Serial.print(batchedTokens * 1e6f / batchedUs, 1);
+    Serial.println(" tokens/s)");
+}
+
+void DogberryAI_Word::benchmarkPrefill() {
+    // Prefills a full SEQ_LENGTH seed token by token, then with the input
+    // projection done as one matrix product, and checks both agree
+    if (active_generator != nullptr) {
+        Serial.println("Model busy with another response");
+        return;
+    }
+    int tokens[SEQ_LENGTH];
+    for (int i = 0; i < SEQ_LENGTH; i++) {
+        tokens[i] = 3 + (i * 97) % (vocab_size - 3);
+    }
+    const int row = 0;
+
+    unsigned long start = micros();
+    resetState(row);
+    for (int i = 0; i < SEQ_LENGTH; i++) {
+        feedTokens(&row, &tokens[i], nullptr, 1);
+    }
+    unsigned long stepwiseUs = micros() - start;
+    float h0 = rowH(row)[0];
+    float hLast = rowH(row)[units - 1];
+
+    start = micros();
+    float* inputs = rowPrefillInputs(row);
+    projectInputs(tokens, SEQ_LENGTH, inputs);
+    resetState(row);
+    for (int i = 0; i < SEQ_LENGTH; i++) {
+        const float* projected = inputs + i * units * 4;
+        feedTokens(&row, &tokens[i], &projected, 1);
+    }
+    unsigned long batchedUs = micros() - start;
+    bool same = rowH(row)[0] == h0 && rowH(row)[units - 1] == hLast;
+
+    Serial.print(SEQ_LENGTH);
+    Serial.print("-token prefill: stepwise ");
+    Serial.print(stepwiseUs / 1000.0f, 1);
+    Serial.print(" ms, batched input projection ");
+    Serial.print(batchedUs / 1000.0f, 1);
+    Serial.print(" ms");
+    Serial.println(same ? "" : " (MISMATCH)");
 }
 
-String DogberryAI_Word::detokenizeWord(int idx) {
-    if (idx < 0 || idx >= VOCAB_SIZE) {
-        return "<UNK>";
+void DogberryAI_Word::benchmarkStreaming() {
+    // Times single-response model steps (LSTM step plus dense layer) with
+    // the weights read straight through and with staged tiles
+    if (active_generator != nullptr) {
+        Serial.println("Model busy with another response");
+        return;
     }
-    return String(VOCAB_WORDS[idx]);
+    const int steps = 16;
+    const int row = 0;
+    bool saved = kernel.streamWeights;
+    unsigned long elapsed[2];
+    float checksum[2];
+
+    for (int mode = 0; mode < 2; mode++) {
+        kernel.streamWeights = mode == 1;
+        resetState(row);
+        unsigned long start = micros();
+        for (int i = 0; i < steps; i++) {
+            int token = 3 + i * 131;
+            feedTokens(&row, &token, nullptr, 1);
+            computeLogits(&row, 1);
+        }
+        elapsed[mode] = micros() - start;
+        checksum[mode] = logits[0] + logits[vocab_size - 1];
+    }
+    kernel.streamWeights = saved;
+
+    Serial.print("Model step: direct ");
+    Serial.print(elapsed[0] / 1000.0f / steps, 2);
+    Serial.print(" ms, staged tiles ");
+    Serial.print(elapsed[1] / 1000.0f / steps, 2);
+    Serial.print(weight_stream.dmaAvailable() ? " ms (async memcpy available)" : " ms (in place)");
+    Serial.println(checksum[0] == checksum[1] ? "" : " MISMATCH");
 }
 
-void DogberryAI_Word::embedding(int word_idx, float* output) {
-    if (word_idx < 0 || word_idx >= VOCAB_SIZE) {
-        memset(output, 0, EMBEDDING_DIM * sizeof(float));
+void DogberryAI_Word::benchmarkSparsity(float threshold) {
+    // Feeds the same tokens to two rows, one exactly and one skipping
+    // hidden units at or below threshold, and compares their logits at
+    // every step
+    if (active_generator != nullptr) {
+        Serial.println("Model busy with another response");
         return;
     }
+    const int steps = 32;
+    const int exactRow = 0;
+    const int sparseRow = 1;
+    float saved = sparsity_threshold;
+    unsigned long elapsed[2] = {0, 0};
+    uint32_t scanned = 0;
+    uint32_t skipped = 0;
+    float maxDiff = 0.0f;
+    int sameTop = 0;
+
+    resetState(exactRow);
+    resetState(sparseRow);
+    for (int i = 0; i < steps; i++) {
+        int token = 3 + i * 131;
+        for (int mode = 0; mode < 2; mode++) {
+            int row = mode == 0 ? exactRow : sparseRow;
+            sparsity_threshold = mode == 0 ? 0.0f : threshold;
+            uint32_t scannedBefore = stats.hUnitsScanned;
+            uint32_t skippedBefore = stats.hUnitsSkipped;
+            unsigned long start = micros();
+            feedTokens(&row, &token, nullptr, 1);
+            computeLogits(&row, 1);
+            elapsed[mode] += micros() - start;
+            if (mode == 1) {
+                scanned += stats.hUnitsScanned - scannedBefore;
+                skipped += stats.hUnitsSkipped - skippedBefore;
+            }
+        }
+
+        const float* exact = rowLogits(exactRow);
+        const float* sparse = rowLogits(sparseRow);
+        int topExact = 0;
+        int topSparse = 0;
+        for (int v = 0; v < vocab_size; v++) {
+            maxDiff = fmaxf(maxDiff, fabsf(exact[v] - sparse[v]));
+            if (exact[v] > exact[topExact]) topExact = v;
+            if (sparse[v] > sparse[topSparse]) topSparse = v;
+        }
+        if (topExact == topSparse) {
+            sameTop++;
+        }
+    }
+    sparsity_threshold = saved;
 
-    int offset = word_idx * EMBEDDING_DIM;
-    for (int i = 0; i < EMBEDDING_DIM; i++) {
-        output[i] = pgm_read_float(&EMBEDDING_WEIGHTS[offset + i]);
+    Serial.print("Sparsity threshold ");
+    Serial.print(threshold, 3);
+    Serial.print(": ");
+    Serial.print(scanned > 0 ? 100.0f * skipped / scanned : 0.0f, 1);
+    Serial.print("% of hidden units skipped, ");
+    Serial.print(elapsed[1] / 1000.0f / steps, 2);
+    Serial.print(" ms/step vs ");
+    Serial.print(elapsed[0] / 1000.0f / steps, 2);
+    Serial.print(" exact, max logit error ");
+    Serial.print(maxDiff, 4);
+    Serial.print(", top token unchanged in ");
+    Serial.print(sameTop);
+    Serial.print("/");
+    Serial.println(steps);
+}
+
+WordView DogberryAI_Word::detokenizeWord(int idx) const {
+    if (idx < 0 || idx >= vocab_size) {
+        idx = TOKEN_UNK;
     }
+
+    // Offsets are stored with one extra entry, so each word's length is
+    // the distance to the next word minus its terminator
+    uint32_t start = pgm_read_dword(&model->vocabOffsets[idx]);
+    uint32_t end = pgm_read_dword(&model->vocabOffsets[idx + 1]);
+    WordView view;
+    view.data = model->vocabPool + start;
+    view.length = end - start - 1;
+    return view;
 }
 
-void DogberryAI_Word::lstm_step(const float* input, float* h, float* c, float* output) {
-    // Use pre-allocated buffer instead of stack array
-    float* gates = lstm_gates;
+const float* DogberryAI_Word::embedding(int word_idx, float* scratch) {
+    // Full-precision rows are used where they are, in memory-mapped flash.
+    // Quantized ones are decoded into scratch, a subspace at a time from
+    // the SRAM codebook.
+    if (word_idx < 0 || word_idx >= vocab_size) {
+        memset(scratch, 0, EMBEDDING_DIM * sizeof(float));
+        return scratch;
+    }
+    if (!pq_codebook) {
+        return model->embedding + word_idx * EMBEDDING_DIM;
+    }
+
+    const int S = model->pqSubspaces;
+    const int D = EMBEDDING_DIM / S;
+    const uint8_t* codes = model->embeddingCodes + word_idx * S;
+    for (int s = 0; s < S; s++) {
+        const float* centroid = pq_codebook + (s * model->pqCentroids + pgm_read_byte(&codes[s])) * D;
+        memcpy(scratch + s * D, centroid, D * sizeof(float));
+    }
+    return scratch;
+}
+
+void DogberryAI_Word::projectInputs(const int* tokens, int len, float* out) {
+    // The input transformation (bias + Wx) of a whole token sequence at
+    // once: a (len x EMBEDDING_DIM) by (EMBEDDING_DIM x 4 * units)
+    // product that reads the LSTM kernel once rather than once per token.
+    // Only the recurrent part has to wait for the previous step. Output columns
+    // are done PROJECT_TILE at a time so the len x PROJECT_TILE block being
+    // accumulated stays in cache.
+    const int G = units * 4;
+
+    // Embeddings of the whole sequence, transposed so each input dimension
+    // is a contiguous run over the tokens
+    float* x = project_scratch;
+    float scratch[EMBEDDING_DIM];
+    for (int t = 0; t < len; t++) {
+        const float* e = embedding(tokens[t], scratch);
+        for (int j = 0; j < EMBEDDING_DIM; j++) {
+            x[j * SEQ_LENGTH + t] = pgm_read_float(&e[j]);
+        }
+    }
 
-    // Compute input transformation: Wx
-    for (int i = 0; i < LSTM_UNITS * 4; i++) {
-        float sum = pgm_read_float(&LSTM_BIAS[i]);
+    for (int i0 = 0; i0 < G; i0 += PROJECT_TILE) {
+        // The last tile may be partial
+        const int i1 = i0 + PROJECT_TILE < G ? i0 + PROJECT_TILE : G;
+        for (int t = 0; t < len; t++) {
+            for (int i = i0; i < i1; i++) {
+                out[t * G + i] = pgm_read_float(&model->lstmBias[i]);
+            }
+        }
         for (int j = 0; j < EMBEDDING_DIM; j++) {
-            sum += input[j] * pgm_read_float(&LSTM_KERNEL[j * LSTM_UNITS * 4 + i]);
+            const float* w = &model->lstmKernel[j * G];
+            for (int t = 0; t < len; t++) {
+                float xt = x[j * SEQ_LENGTH + t];
+                float* o = out + t * G;
+                for (int i = i0; i < i1; i++) {
+                    o[i] += xt * pgm_read_float(&w[i]);
+                }
+            }
         }
-        gates[i] = sum;
     }
+}
 
-    // Add recurrent transformation: Uh
-    for (int i = 0; i < LSTM_UNITS * 4; i++) {
-        for (int j = 0; j < LSTM_UNITS; j++) {
-            gates[i] += h[j] * pgm_read_float(&LSTM_RECURRENT[j * LSTM_UNITS * 4 + i]);
+int DogberryAI_Word::activeUnits(const float* const* h, int n, int* active) {
+    // Lists the hidden units some row of the batch needs: those with |h|
+    // above the sparsity threshold in at least one row. Built once per
+    // kernel call and shared by every output it computes.
+    int nActive = 0;
+    if (sparsity_threshold <= 0.0f) {
+        for (int j = 0; j < units; j++) {
+            active[nActive++] = j;
+        }
+    } else {
+        for (int j = 0; j < units; j++) {
+            for (int r = 0; r < n; r++) {
+                if (fabsf(h[r][j]) > sparsity_threshold) {
+                    active[nActive++] = j;
+                    break;
+                }
+            }
         }
     }
+    stats.hUnitsScanned += units;
+    stats.hUnitsSkipped += units - nActive;
+    return nActive;
+}
 
-    // Apply activations and update cell state
-    for (int i = 0; i < LSTM_UNITS; i++) {
-        float i_gate = 1.0f / (1.0f + expf(-gates[i]));                    // input gate (sigmoid)
-        float f_gate = 1.0f / (1.0f + expf(-gates[LSTM_UNITS + i]));       // forget gate (sigmoid)
-        float c_gate = tanhf(gates[LSTM_UNITS * 2 + i]);                   // cell gate (tanh)
-        float o_gate = 1.0f / (1.0f + expf(-gates[LSTM_UNITS * 3 + i]));   // output gate (sigmoid)
+void DogberryAI_Word::accumulate(const float* weights, int rows, int cols,
+                                 const float* const* in, float* const* out, int n,
+                                 const int* rowList) {
+    // out[r] += in[r] * W for n vectors at once, W being rows x cols. The
+    // weights are walked one row (input) at a time and each value read is
+    // applied to every vector before moving on, so a batch costs one pass
+    // over W instead of one pass per response. The rows arrive in tiles
+    // from the weight stream. With a rowList only those rows of W are
+    // used, and rows is its length.
+    weight_stream.start(weights, rows, cols, kernel.streamWeights, rowList);
+    float x[MAX_BATCH];
+    const float* tile;
+    int j0;
+    int nRows;
+    while ((tile = weight_stream.next(&j0, &nRows)) != nullptr) {
+        for (int jj = 0; jj < nRows; jj++) {
+            for (int r = 0; r < n; r++) {
+                x[r] = in[r][j0 + jj];
+            }
+            const float* w = tile + jj * cols;
+            int i = 0;
+            if (kernel.unroll == 4) {
+                for (; i + 4 <= cols; i += 4) {
+                    float w0 = pgm_read_float(&w[i]);
+                    float w1 = pgm_read_float(&w[i + 1]);
+                    float w2 = pgm_read_float(&w[i + 2]);
+                    float w3 = pgm_read_float(&w[i + 3]);
+                    for (int r = 0; r < n; r++) {
+                        float* o = out[r] + i;
+                        o[0] += x[r] * w0;
+                        o[1] += x[r] * w1;
+                        o[2] += x[r] * w2;
+                        o[3] += x[r] * w3;
+                    }
+                }
+            }
+            for (; i < cols; i++) {
+                float weight = pgm_read_float(&w[i]);
+                for (int r = 0; r < n; r++) {
+                    out[r][i] += x[r] * weight;
+                }
+            }
+        }
+    }
+}
 
-        c[i] = f_gate * c[i] + i_gate * c_gate;
-        h[i] = o_gate * tanhf(c[i]);
+bool DogberryAI_Word::loadCodebook() {
+    // Every embedding lookup reads pqSubspaces centroids, so the codebook
+    // is copied out of flash into the arena (internal SRAM unless short)
+    size_t bytes = EMBEDDING_DIM * model->pqCentroids * sizeof(float);
+    for (size_t i = 0; i < bytes / sizeof(float); i++) {
+        pq_codebook[i] = pgm_read_float(&model->embeddingCodebook[i]);
     }
 
-    memcpy(output, h, LSTM_UNITS * sizeof(float));
+    Serial.print("Embeddings product-quantized: ");
+    Serial.print(vocab_size * model->pqSubspaces / 1024);
+    Serial.print(" KB of codes, ");
+    Serial.print(bytes / 1024);
+    Serial.println(" KB codebook");
+    return true;
 }
 
-void DogberryAI_Word::dense(const float* input, float* output) {
-    for (int i = 0; i < VOCAB_SIZE; i++) {
-        float sum = pgm_read_float(&DENSE_BIAS[i]);
-        for (int j = 0; j < LSTM_UNITS; j++) {
-            sum += input[j] * pgm_read_float(&DENSE_KERNEL[j * VOCAB_SIZE + i]);
+bool DogberryAI_Word::packLstmWeights() {
+    // Keras stores the gates as four blocks of `units` columns. The
+    // fused kernel wants unit k's i, f, c and o weights side by side, for
+    // the input and then the recurrent weights, so a unit is one
+    // contiguous fused_cols run.
+    if (model->lstmFused) {
+        lstm_fused = model->lstmFused;
+        lstm_fused_bias = model->lstmFusedBias;
+        Serial.println("LSTM weights come interleaved");
+        return true;
+    }
+
+    unsigned long start = millis();
+    float* fused = (float*)ps_malloc(units * fused_cols * sizeof(float));
+    float* fusedBias = (float*)ps_malloc(units * 4 * sizeof(float));
+    if (!fused || !fusedBias) {
+        Serial.println("Failed to allocate fused LSTM weights");
+        free(fused);
+        free(fusedBias);
+        return false;
+    }
+    lstm_fused = fused;
+    lstm_fused_bias = fusedBias;
+
+    const int G = units * 4;
+    for (int k = 0; k < units; k++) {
+        float* unit = fused + k * fused_cols;
+        for (int g = 0; g < 4; g++) {
+            fusedBias[k * 4 + g] = pgm_read_float(&model->lstmBias[g * units + k]);
+            for (int j = 0; j < EMBEDDING_DIM; j++) {
+                unit[j * 4 + g] = pgm_read_float(&model->lstmKernel[j * G + g * units + k]);
+            }
+            for (int j = 0; j < units; j++) {
+                unit[(EMBEDDING_DIM + j) * 4 + g] =
+                    pgm_read_float(&model->lstmRecurrent[j * G + g * units + k]);
+            }
         }
-        output[i] = sum;
     }
+
+    Serial.print("LSTM weights interleaved in ");
+    Serial.print(millis() - start);
+    Serial.println(" ms");
+    return true;
 }
 
-int DogberryAI_Word::sample(const float* logits, float temperature) {
+bool DogberryAI_Word::denseKernelInPsram() const {
+#ifdef ESP_PLATFORM
+    return esp_ptr_external_ram(model->denseKernel);
+#else
+    return false;
+#endif
+}
+
+bool DogberryAI_Word::applyKernelConfig(const KernelConfig& config) {
+    // A second copy of a kernel already in PSRAM would only cost memory
+    if (config.denseInPsram && !dense_psram && !denseKernelInPsram()) {
+        // Aligned so WeightStream can copy rows out of it with DMA
+#ifdef ESP_PLATFORM
+        dense_psram = (float*)heap_caps_aligned_alloc(64, units * vocab_size * sizeof(float),
+                                                      MALLOC_CAP_SPIRAM);
+#else
+        dense_psram = (float*)ps_malloc(units * vocab_size * sizeof(float));
+#endif
+        if (!dense_psram) {
+            Serial.println("No PSRAM for a copy of the dense weights");
+            return false;
+        }
+        for (int i = 0; i < units * vocab_size; i++) {
+            dense_psram[i] = pgm_read_float(&model->denseKernel[i]);
+        }
+    } else if (!config.denseInPsram && dense_psram) {
+        free(dense_psram);
+        dense_psram = nullptr;
+    }
+
+    kernel = config;
+    weight_stream.setTileFloats(config.tileFloats);
+    return true;
+}
+
+float DogberryAI_Word::timeModelSteps(int steps, float* checksum) {
+    if (active_generator != nullptr) {
+        return -1.0f;
+    }
+    const int row = 0;
+    resetState(row);
+    unsigned long start = micros();
+    for (int i = 0; i < steps; i++) {
+        int token = 3 + (i * 131) % (vocab_size - 3);
+        feedTokens(&row, &token, nullptr, 1);
+        computeLogits(&row, 1);
+    }
+    unsigned long elapsed = micros() - start;
+
+    float sum = 0.0f;
+    for (int i = 0; i < vocab_size; i++) {
+        sum += logits[i];
+    }
+    *checksum = sum;
+    return (float)elapsed / steps;
+}
+
+static uint32_t fnvMix(uint32_t hash, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        hash ^= (value >> (i * 8)) & 0xff;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+uint32_t DogberryAI_Word::modelHash() const {
+    // FNV-1a over the architecture and every 61st value of each weight
+    // array; reading all of them from flash would hold up boot
+    struct WeightArray {
+        const float* data;
+        int count;
+    };
+    const WeightArray arrays[] = {
+        {model->embedding, model->embedding ? vocab_size * EMBEDDING_DIM : 0},
+        {model->embeddingCodebook, model->pqSubspaces > 0 ? EMBEDDING_DIM * model->pqCentroids : 0},
+        {model->lstmKernel, EMBEDDING_DIM * units * 4},
+        {model->lstmRecurrent, model->lstmRecurrent ? units * units * 4 : 0},
+        {model->lstmFused, model->lstmFused ? units * fused_cols : 0},
+        {model->lstmBias, units * 4},
+        {model->denseKernel, units * vocab_size},
+        {model->denseBias, vocab_size},
+    };
+
+    uint32_t hash = 2166136261u;
+    hash = fnvMix(hash, vocab_size);
+    hash = fnvMix(hash, EMBEDDING_DIM);
+    hash = fnvMix(hash, units);
+    for (const WeightArray& array : arrays) {
+        for (int i = 0; i < array.count; i += 61) {
+            float value = pgm_read_float(&array.data[i]);
+            uint32_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            hash = fnvMix(hash, bits);
+        }
+    }
+    return hash;
+}
+
+void DogberryAI_Word::lstm_step(const int* rows, const float* const* inputs,
+                                const float* const* projected, int n) {
+    // One pass per unit k: bias, input and recurrent products for its four
+    // gates, then the activations and the c/h update, for all n rows. Units
+    // arrive a tile at a time from the weight stream, and each weight read
+    // is applied to every row. The new h goes into the row's other h
+    // buffer, since the remaining units still need the old one. Only the
+    // active hidden units (see activeUnits) enter the recurrent product.
+    // inputs holds each unprojected row's embedding.
+    const float* const* x = inputs;
+    const float* hPrev[MAX_BATCH] = {};
+    float* hNext[MAX_BATCH] = {};
+    float* c[MAX_BATCH] = {};
+    int live[MAX_BATCH];
+    int nLive = 0;
+    for (int r = 0; r < n; r++) {
+        int row = rows[r];
+        hPrev[r] = rowH(row);
+        hNext[r] = lstm_h + ((h_parity[row] ^ 1) * MAX_BATCH + row) * units;
+        c[r] = lstm_c + row * units;
+        // Rows with a projected input already have bias + Wx
+        if (!projected || !projected[r]) {
+            live[nLive++] = r;
+        }
+    }
+
+    int active[LSTM_UNITS];
+    int nActive = activeUnits(hPrev, n, active);
+
+    weight_stream.start(lstm_fused, units, fused_cols, kernel.streamWeights);
+    float acc[MAX_BATCH][4];
+    const float* tile;
+    int k0;
+    int nUnits;
+    while ((tile = weight_stream.next(&k0, &nUnits)) != nullptr) {
+        for (int kk = 0; kk < nUnits; kk++) {
+            int k = k0 + kk;
+            const float* w = tile + kk * fused_cols;
+
+            for (int r = 0; r < n; r++) {
+                for (int g = 0; g < 4; g++) {
+                    acc[r][g] = (projected && projected[r]) ? projected[r][g * units + k]
+                                                            : lstm_fused_bias[k * 4 + g];
+                }
+            }
+
+            // Input transformation: Wx
+            for (int j = 0; j < EMBEDDING_DIM; j++) {
+                const float* wj = w + j * 4;
+                for (int l = 0; l < nLive; l++) {
+                    int r = live[l];
+                    float xj = pgm_read_float(&x[r][j]);
+                    for (int g = 0; g < 4; g++) {
+                        acc[r][g] += xj * wj[g];
+                    }
+                }
+            }
+
+            // Recurrent transformation: Uh
+            const float* u = w + EMBEDDING_DIM * 4;
+            for (int a = 0; a < nActive; a++) {
+                int j = active[a];
+                const float* uj = u + j * 4;
+                for (int r = 0; r < n; r++) {
+                    float hj = hPrev[r][j];
+                    for (int g = 0; g < 4; g++) {
+                        acc[r][g] += hj * uj[g];
+                    }
+                }
+            }
+
+            // Apply activations and update cell state
+            for (int r = 0; r < n; r++) {
+                float i_gate = 1.0f / (1.0f + expf(-acc[r][0]));   // input gate (sigmoid)
+                float f_gate = 1.0f / (1.0f + expf(-acc[r][1]));   // forget gate (sigmoid)
+                float c_gate = tanhf(acc[r][2]);                   // cell gate (tanh)
+                float o_gate = 1.0f / (1.0f + expf(-acc[r][3]));   // output gate (sigmoid)
+
+                c[r][k] = f_gate * c[r][k] + i_gate * c_gate;
+                hNext[r][k] = o_gate * tanhf(c[r][k]);
+            }
+        }
+    }
+
+    for (int r = 0; r < n; r++) {
+        h_parity[rows[r]] ^= 1;
+    }
+}
+
+void DogberryAI_Word::dense(const int* rows, int n) {
+    const float* input[MAX_BATCH];
+    float* output[MAX_BATCH];
+    for (int r = 0; r < n; r++) {
+        input[r] = rowH(rows[r]);
+        output[r] = logits + rows[r] * vocab_size;
+        for (int i = 0; i < vocab_size; i++) {
+            output[r][i] = pgm_read_float(&model->denseBias[i]);
+        }
+    }
+    // Skipped units leave out whole rows of the dense kernel
+    int active[LSTM_UNITS];
+    int nActive = activeUnits(input, n, active);
+    const float* weights = dense_psram ? dense_psram : model->denseKernel;
+    accumulate(weights, nActive, vocab_size, input, output, n,
+               nActive < units ? active : nullptr);
+}
+
+int DogberryAI_Word::sample(float* logits, const SamplingConfig& sampling,
+                            const PenaltyTracker* penalties) {
+    float temperature = sampling.temperature;
+    if (penalties) {
+        penalties->apply(logits, sampling);
+    }
+
     // Find max for numerical stability
     float max_logit = logits[0];
-    for (int i = 1; i < VOCAB_SIZE; i++) {
+    for (int i = 1; i < vocab_size; i++) {
         if (logits[i] > max_logit) {
             max_logit = logits[i];
         }
@@ -206,47 +1025,168 @@ int DogberryAI_Word::sample(const float* logits, float temperature) {
     // Compute exp(logit / temperature) and sum
     // Use pre-allocated probs buffer instead of stack array
     float sum = 0.0f;
-    for (int i = 0; i < VOCAB_SIZE; i++) {
+    for (int i = 0; i < vocab_size; i++) {
         probs[i] = expf((logits[i] - max_logit) / temperature);
         sum += probs[i];
     }
 
     // Normalize
-    for (int i = 0; i < VOCAB_SIZE; i++) {
+    for (int i = 0; i < vocab_size; i++) {
         probs[i] /= sum;
     }
 
     // Sample from distribution
     float r = (float)random(0, 10000) / 10000.0f;
     float cumulative = 0.0f;
-    for (int i = 0; i < VOCAB_SIZE; i++) {
+    for (int i = 0; i < vocab_size; i++) {
         cumulative += probs[i];
         if (r <= cumulative) {
+            last_logprob = logf(fmaxf(probs[i], 1e-12f));
             return i;
         }
     }
 
-    return VOCAB_SIZE - 1;
+    last_logprob = logf(fmaxf(probs[vocab_size - 1], 1e-12f));
+    return vocab_size - 1;
+}
+
+void DogberryAI_Word::resetState(int row) {
+    memset(rowH(row), 0, units * sizeof(float));
+    memset(lstm_c + row * units, 0, units * sizeof(float));
+}
+
+void DogberryAI_Word::feedTokens(const int* rows, const int* tokens,
+                                 const float* const* projected, int n) {
+    const float* inputs[MAX_BATCH] = {};
+    for (int r = 0; r < n; r++) {
+        if (!projected || !projected[r]) {
+            inputs[r] = embedding(tokens[r], embedding_output + r * EMBEDDING_DIM);
+        }
+    }
+    lstm_step(rows, inputs, projected, n);
+}
+
+void DogberryAI_Word::computeLogits(const int* rows, int n) {
+    dense(rows, n);
 }
 
-void DogberryAI_Word::cleanResponse(String& response) {
-    // Remove any leading/trailing whitespace
-    response.trim();
+bool DogberryAI_Word::cacheSeed(const char* seedText) {
+    int tokens[SEQ_LENGTH];
+    int len = tokenizeText(seedText, tokens, SEQ_LENGTH);
+    if (len == 0 || findPrefix(tokens, len) >= 0) {
+        return len > 0;
+    }
+    if (prefix_count >= PREFIX_CACHE_SIZE) {
+        Serial.println("Prefix cache full");
+        return false;
+    }
+
+    // h, c and the first step's logits in one PSRAM block
+    float* block = (float*)ps_malloc((2 * units + vocab_size) * sizeof(float));
+    if (!block) {
+        Serial.println("Failed to allocate prefix cache entry");
+        return false;
+    }
+
+    // Project the whole seed at once, then run the recurrent steps
+    const int row = 0;
+    float* inputs = rowPrefillInputs(row);
+    projectInputs(tokens, len, inputs);
+    resetState(row);
+    for (int i = 0; i < len; i++) {
+        const float* projected = inputs + i * units * 4;
+        feedTokens(&row, &tokens[i], &projected, 1);
+    }
+    computeLogits(&row, 1);
+
+    PrefixEntry& entry = prefix_cache[prefix_count++];
+    for (int i = 0; i < len; i++) {
+        entry.tokens[i] = (int16_t)tokens[i];
+    }
+    entry.len = len;
+    entry.h = block;
+    entry.c = block + units;
+    entry.logits = block + 2 * units;
+    memcpy(entry.h, rowH(row), units * sizeof(float));
+    memcpy(entry.c, lstm_c + row * units, units * sizeof(float));
+    memcpy(entry.logits, rowLogits(row), vocab_size * sizeof(float));
+    return true;
+}
 
-    // Remove the seed prompt if it appears at the start
-    // (This happens when the model echoes back the input)
-    int firstSpace = response.indexOf(' ');
-    if (firstSpace > 0) {
-        String firstWord = response.substring(0, firstSpace);
-        firstWord.toLowerCase();
-        if (firstWord == "dogberry" || firstWord == "hey" || firstWord == "hello") {
-            response = response.substring(firstSpace + 1);
-            response.trim();
+int DogberryAI_Word::findPrefix(const int* tokens, int len) const {
+    for (int i = 0; i < prefix_count; i++) {
+        const PrefixEntry& entry = prefix_cache[i];
+        if (entry.len != len) {
+            continue;
+        }
+        int j = 0;
+        while (j < len && entry.tokens[j] == tokens[j]) {
+            j++;
+        }
+        if (j == len) {
+            return i;
         }
     }
+    return -1;
+}
 
-    // Capitalize first letter
-    if (response.length() > 0) {
-        response.setCharAt(0, toupper(response.charAt(0)));
+bool DogberryAI_Word::restorePrefix(int row, const int* tokens, int len) {
+    int i = findPrefix(tokens, len);
+    if (i < 0) {
+        return false;
     }
+
+    const PrefixEntry& entry = prefix_cache[i];
+    memcpy(rowH(row), entry.h, units * sizeof(float));
+    memcpy(lstm_c + row * units, entry.c, units * sizeof(float));
+    memcpy(rowLogits(row), entry.logits, vocab_size * sizeof(float));
+    stats.prefixHits++;
+    return true;
+}
+
+void DogberryAI_Word::printStats() const {
+    Serial.print("Generation stats (");
+    Serial.print(model->name);
+    Serial.print(" model): ");
+    Serial.print(stats.responses);
+    Serial.print(" responses in ");
+    Serial.print(stats.batches);
+    Serial.print(" batches, ");
+    Serial.print(stats.aborts);
+    Serial.print(" aborted attempts, ");
+    Serial.print(stats.tokensWasted);
+    Serial.print("/");
+    Serial.print(stats.tokensSampled);
+    Serial.print(" tokens wasted (");
+    Serial.print(stats.wastedPercent(), 1);
+    Serial.print("%), ");
+    Serial.print(stats.lengthTruncated);
+    Serial.print(" cut to fit length, ");
+    Serial.print(stats.prefixHits);
+    Serial.print(" seed prefills skipped, ");
+    Serial.print(stats.conversationHits);
+    Serial.print("/");
+    Serial.print(stats.conversationHits + stats.conversationMisses);
+    Serial.print(" thread states reused (");
+    uint32_t lookups = stats.conversationHits + stats.conversationMisses;
+    Serial.print(lookups > 0 ? 100.0f * stats.conversationHits / lookups : 0.0f, 1);
+    Serial.print("%), peak heap use ");
+    Serial.print(stats.heapPeakBytes);
+    Serial.print(" bytes, ");
+    Serial.print(stats.cancelled);
+    Serial.print(" cancelled, last time to first token ");
+    Serial.print(stats.lastFirstTokenUs / 1000);
+    Serial.print(" ms, ");
+    Serial.print(stats.hUnitsSkipped);
+    Serial.print("/");
+    Serial.print(stats.hUnitsScanned);
+    Serial.print(" hidden units skipped (");
+    Serial.print(stats.hUnitsScanned > 0 ? 100.0f * stats.hUnitsSkipped / stats.hUnitsScanned : 0.0f, 1);
+    Serial.print("%), ");
+    Serial.print(stats.budgetTruncated);
+    Serial.print(" budget-truncated (");
+    Serial.print(stats.responses > 0 ? 100.0f * stats.budgetTruncated / stats.responses : 0.0f, 1);
+    Serial.print("%), ~");
+    Serial.print(token_cost_us / 1000.0f, 1);
+    Serial.println(" ms/token");
 }
@@ -2,39 +2,322 @@
 #define DOGBERRYAI_WORD_H
 
 #include <Arduino.h>
+#include "SamplingState.h"
+#include "WeightStream.h"
+#include "ActivationArena.h"
+#include "ResponseBuilder.h"
+#include "vocab_pool_word.h"
 
-// Model architecture
-#define VOCAB_SIZE 4000
+// Model architecture. The vocabulary size is not fixed: it comes with the
+// model (see vocabSize()), so a pruned vocabulary only needs the model and
+// tables regenerated.
 #define SEQ_LENGTH 40
 #define EMBEDDING_DIM 64
-#define LSTM_UNITS 256
+#define LSTM_UNITS 256   // Of the full model; no model may be larger
+#define LSTM_UNITS_MULTIPLE 16  // Every model's unit count is a multiple of this
+
+// Floats per unit in the gate-interleaved LSTM weights of a model with
+// this many units: the four gate weights (i, f, c, o) of every input,
+// then of every recurrent input
+#define LSTM_FUSED_COLS(units) ((EMBEDDING_DIM + (units)) * 4)
+
+// One model's weights, in the Keras export layout, and its vocabulary.
+// Models share EMBEDDING_DIM but may have fewer LSTM units.
+struct ModelWeights {
+    const char* name;
+    int units;
+    const float* embedding;      // vocab x EMBEDDING_DIM
+    const float* lstmKernel;     // EMBEDDING_DIM x 4*units
+    const float* lstmRecurrent;  // units x 4*units
+    const float* lstmBias;       // 4*units
+    const float* denseKernel;    // units x vocab
+    const float* denseBias;      // vocab
+
+    // Product-quantized embeddings (tools/pq_embeddings.py), used instead
+    // of embedding when pqSubspaces > 0: each word is pqSubspaces one-byte
+    // codes, each choosing one of pqCentroids centroids for its
+    // EMBEDDING_DIM / pqSubspaces dimensions
+    int pqSubspaces;
+    int pqCentroids;
+    const uint8_t* embeddingCodes;   // vocab x pqSubspaces
+    const float* embeddingCodebook;  // pqSubspaces x pqCentroids x EMBEDDING_DIM / pqSubspaces
+
+    // Tables laid out as in vocab_pool_word.h
+    int vocabCount;
+    const char* vocabPool;
+    const vocab_offset_t* vocabOffsets;  // vocabCount + 1
+    const uint16_t* vocabSorted;
+
+    // The LSTM weights already gate-interleaved (tools/compile_model.py),
+    // used in place instead of being repacked at boot; nullptr if not.
+    // lstmRecurrent may then be nullptr.
+    const float* lstmFused;      // units x LSTM_FUSED_COLS(units)
+    const float* lstmFusedBias;  // units x 4
+};
+
+// Special token ids, fixed by the training export
+#define TOKEN_PAD 0
+#define TOKEN_UNK 1
+#define TOKEN_START 2
+
+#define MAX_VOCAB_SIZE 0x7FFF  // Token ids are kept as int16_t, -1 meaning none
+
+#define MAX_WORD_BYTES 32   // Longer words map to <UNK>
+
+// A word in the flash-resident vocabulary pool (vocab_pool_word.h).
+// data is NUL-terminated, so it can also be used as a C string.
+struct WordView {
+    const char* data;
+    int length;
+};
+
+// Seeds whose LSTM state is precomputed at boot
+#define PREFIX_CACHE_SIZE 16
+
+// Responses that can be generated together, sharing every weight read
+#define MAX_BATCH 8
+
+// Output columns per block of the seed input projection
+#define PROJECT_TILE 64
+// Hidden units with |h| at or below this in every batch row are left out
+// of the recurrent and dense products; 0 = exact, nothing skipped
+#define DEFAULT_SPARSITY_THRESHOLD 0.0f
+
+// Generation limits
+#define MAX_STOP_TOKENS 4
+#define RESPONSE_BUFFER_SIZE 1024 // Bytes; comfortably above MAX_POST_GRAPHEMES of UTF-8
+
+// Latency prediction for timeBudgetMs
+#define TOKEN_COST_EWMA_ALPHA 0.2f        // Weight of the newest sample
+#define INITIAL_TOKEN_COST_US 50000.0f    // Until the first tokens have been timed
+#define INITIAL_SENTENCE_TOKENS 12.0f
+
+// Kernel settings that change how fast a model step runs but not what it
+// computes. The best ones depend on the board's flash and PSRAM setup;
+// KernelTuner measures them.
+struct KernelConfig {
+    bool streamWeights = true;            // Stage weight tiles ahead of the mat-vecs (WeightStream)
+    int tileFloats = WEIGHT_TILE_FLOATS;  // Largest staged tile
+    int unroll = 1;                       // Dense layer columns per inner-loop iteration: 1 or 4
+    bool denseInPsram = false;            // Read DENSE_KERNEL from a PSRAM copy instead of flash
+};
+
+// Everything that shapes one call to generateResponse
+struct GenerationConfig {
+    SamplingConfig sampling;
+    int maxWords = 40;
+    int maxGraphemes = MAX_POST_GRAPHEMES;   // Cut back to the last sentence end that fits
+    const char* stopTokens[MAX_STOP_TOKENS] = {".", nullptr, nullptr, nullptr};  // Emitted, then generation ends
+    unsigned long timeBudgetMs = 0;          // Wall clock from the start, 0 = no limit.
+                                             // Ends at the last sentence that fits.
+};
+
+// One generated token, as passed to a TokenCallback
+struct TokenEvent {
+    int token;
+    WordView text;
+    float logprob;           // Under the distribution it was sampled from
+    uint32_t elapsedUs;      // Since generateResponse was called
+    int index;               // 0 for the first token streamed by this call
+    int attempt;             // Increases if a degenerate attempt was restarted;
+                             // tokens from the earlier attempt are void
+    int slot;                // Which response of a batch it belongs to
+};
+
+// Called for every token added to the response. Return false to stop
+// generation; the response keeps the text produced so far.
+typedef bool (*TokenCallback)(const TokenEvent& event, void* context);
+
+// Counters accumulated across generateResponse calls
+struct GenerationStats {
+    uint32_t responses = 0;
+    uint32_t aborts = 0;         // Attempts abandoned as degenerate
+    uint32_t tokensSampled = 0;  // Every token drawn, including aborted attempts
+    uint32_t tokensWasted = 0;   // Tokens drawn by attempts that were abandoned
+    uint32_t lengthTruncated = 0;  // Responses cut back to fit maxGraphemes
+    uint32_t prefixHits = 0;       // Attempts that resumed from a cached seed state
+    uint32_t heapPeakBytes = 0;    // Most internal heap in use at once during a response
+    uint32_t cancelled = 0;        // Responses stopped early by a TokenCallback
+    uint32_t lastFirstTokenUs = 0; // Time to first token of the last streamed response
+    uint32_t budgetTruncated = 0;  // Responses ended early to meet timeBudgetMs
+    uint32_t batches = 0;          // Generator runs, each producing one or more responses
+    uint32_t conversationHits = 0;   // Replies that continued a cached thread state
+    uint32_t conversationMisses = 0; // Replies in a thread with no cached state
+    uint32_t hUnitsScanned = 0;    // Hidden units considered by the recurrent and dense products
+    uint32_t hUnitsSkipped = 0;    // ...of which left out as below the sparsity threshold
+
+    float wastedPercent() const {
+        return tokensSampled > 0 ? 100.0f * tokensWasted / tokensSampled : 0.0f;
+    }
+};
+
+class ResponseGenerator;
 
 class DogberryAI_Word {
 public:
-    DogberryAI_Word();
+    // Runs the given model, by default the full one
+    explicit DogberryAI_Word(const ModelWeights* weights = fullModel());
     ~DogberryAI_Word();
 
+    // The compiled-in models. The fast one is built from
+    // model_weights_small.h (the export with SMALL_-prefixed arrays and
+    // SMALL_LSTM_UNITS) and is nullptr when that file is absent. Builds
+    // with MODEL_CONTAINER defined have no full model compiled in; it is
+    // loaded from flash with ModelContainer instead.
+    static const ModelWeights* fullModel();
+    static const ModelWeights* fastModel();
+
     bool initialize();
     String generateResponse(const String& seedText, int maxWords = 40);
+    String generateResponse(const String& seedText, const GenerationConfig& config);
+
+    // Writes the response into out (NUL-terminated) without allocating;
+    // returns its length in bytes
+    int generateResponse(const char* seedText, const GenerationConfig& config,
+                         char* out, int outSize);
+
+    // Streaming variant: onToken sees each token as soon as it is sampled.
+    // These all block until done; see ResponseGenerator to interleave
+    // generation with other work.
+    int generateResponse(const char* seedText, const GenerationConfig& config,
+                         TokenCallback onToken, void* context, char* out, int outSize);
+
+    // Splits UTF-8 text into vocabulary ids without allocating; returns the count
+    int tokenizeText(const char* text, int* tokens, int maxTokens);
+
+    // Runs a fixed seed phrase once and keeps the resulting state, so
+    // generateResponse can skip prefill whenever it is used as the seed
+    bool cacheSeed(const char* seedText);
+
+    // Diagnostics, run from the serial console
+    bool testTokenizer();
+    void benchmarkTokenizer();
+    void benchmarkBatch();
+    void benchmarkPrefill();
+    void benchmarkStreaming();
+    void benchmarkSparsity(float threshold);
+
+    // Weight tiles staged ahead of the mat-vecs (see WeightStream), or
+    // each matrix read straight through in one pass
+    void setWeightStreaming(bool enabled) { kernel.streamWeights = enabled; }
+
+    // Returns false, keeping the current settings, if the PSRAM copy of
+    // the dense weights can't be allocated
+    bool applyKernelConfig(const KernelConfig& config);
+    const KernelConfig& kernelConfig() const { return kernel; }
+
+    // The dense kernel is in PSRAM already (expanded from a model
+    // container), so denseInPsram reads it in place and gains nothing
+    bool denseKernelInPsram() const;
+
+    // Runs steps single-response model steps (LSTM step plus dense layer)
+    // from a fresh state; returns microseconds per step. checksum receives
+    // a sum over the final logits, for checking variants agree. Returns
+    // -1 while a ResponseGenerator holds the model.
+    float timeModelSteps(int steps, float* checksum);
+
+    // Fingerprint of the model's weights, for keying tuned settings
+    uint32_t modelHash() const;
+
+    // Trades accuracy for speed by skipping near-zero hidden units; see
+    // DEFAULT_SPARSITY_THRESHOLD
+    void setSparsityThreshold(float threshold) { sparsity_threshold = threshold; }
+    float sparsityThreshold() const { return sparsity_threshold; }
+
+    int vocabSize() const { return vocab_size; }
+    const char* modelName() const { return model->name; }
+    int lstmUnits() const { return units; }
+
+    // Wall-clock time of one generated token, as predicted for deadlines
+    float tokenCostUs() const { return token_cost_us; }
+
+    const GenerationStats& getStats() const { return stats; }
+    void printStats() const;
 
 private:
-    // Pre-allocated buffers (in PSRAM)
-    float* embedding_output;
-    float* lstm_h;
-    float* lstm_c;
-    float* lstm_output;
-    float* logits;
+    // Inference buffers, carved out of the activation arena: the state and
+    // the small per-step buffers in internal SRAM, logits and prefill
+    // projections in PSRAM. The state of the responses in a batch is
+    // stacked: row r of each buffer belongs to batch slot r.
+    ActivationArena arena;
+    float* embedding_output;  // MAX_BATCH x EMBEDDING_DIM, for decoded embeddings
+    float* lstm_h;            // 2 x MAX_BATCH x units: each row's h is double-buffered,
+    uint8_t h_parity[MAX_BATCH];  // and this says which copy is current
+    float* lstm_c;            // MAX_BATCH x units
+    float* logits;            // MAX_BATCH x vocab_size
     float* probs;  // Probability distribution buffer
-    float* lstm_gates;  // Buffer for LSTM gate computations
+    float* prefill_inputs;  // Input projections of each slot's seed, MAX_BATCH x SEQ_LENGTH x 4*units
+    float* project_scratch;  // A seed's embeddings, transposed: EMBEDDING_DIM x SEQ_LENGTH
+
+    const ModelWeights* model;
+    int units;       // LSTM units of this model
+    int fused_cols;  // LSTM_FUSED_COLS(units)
+    int vocab_size;
+
+    float last_logprob;  // Log-prob of the token most recently returned by sample()
+
+    WeightStream weight_stream;
+    KernelConfig kernel;
+    float* dense_psram;  // Copy of the dense kernel while kernel.denseInPsram
+    float sparsity_threshold;
+
+    // The LSTM kernel, recurrent weights and bias with each unit's four
+    // gates adjacent (units x fused_cols): the model's own if it comes
+    // interleaved, else repacked at boot into PSRAM
+    const float* lstm_fused;
+    const float* lstm_fused_bias;  // units x 4
+
+    // The model's PQ codebook, copied to the arena's SRAM (nullptr if the
+    // embeddings aren't quantized)
+    float* pq_codebook;
+
+    // State after each cached seed, in PSRAM (one block per entry)
+    struct PrefixEntry {
+        int16_t tokens[SEQ_LENGTH];
+        int len;
+        float* h;
+        float* c;
+        float* logits;  // First generation step's logits
+    };
+    PrefixEntry prefix_cache[PREFIX_CACHE_SIZE];
+    int prefix_count;
+
+    GenerationStats stats;
+    ResponseGenerator* active_generator;  // Owner of the LSTM state, if any
+
+    // Running averages (EWMA) carried across responses for deadline planning
+    float token_cost_us;    // Wall-clock time per generated token (one step of a batch)
+    float sentence_tokens;  // Words per sentence
+    bool token_cost_timed;  // token_cost_us is still INITIAL_TOKEN_COST_US until set
+
+    // Model steps, driven by ResponseGenerator. Each step runs the given
+    // batch rows together. Rows with a projected input (from projectInputs)
+    // skip the embedding and W_x; their token is ignored.
+    friend class ResponseGenerator;
+    void resetState(int row);
+    void projectInputs(const int* tokens, int len, float* out);
+    void feedTokens(const int* rows, const int* tokens, const float* const* projected, int n);
+    void computeLogits(const int* rows, int n);
+    float* rowLogits(int row) { return logits + row * vocab_size; }
+    float* rowH(int row) { return lstm_h + (h_parity[row] * MAX_BATCH + row) * units; }
+    float* rowC(int row) { return lstm_c + row * units; }
+    float* rowPrefillInputs(int row) { return prefill_inputs + row * SEQ_LENGTH * units * 4; }
 
     // Helper functions
-    int tokenizeWord(const String& word);
-    String detokenizeWord(int idx);
-    void embedding(int word_idx, float* output);
-    void lstm_step(const float* input, float* h, float* c, float* output);
-    void dense(const float* input, float* output);
-    int sample(const float* logits, float temperature);
-    void cleanResponse(String& response);
+    bool packLstmWeights();
+    bool loadCodebook();
+    int findPrefix(const int* tokens, int len) const;
+    bool restorePrefix(int row, const int* tokens, int len);
+    int tokenizeWord(const char* word, int len);
+    WordView detokenizeWord(int idx) const;
+    const float* embedding(int word_idx, float* scratch);
+    int activeUnits(const float* const* h, int n, int* active);
+    void accumulate(const float* weights, int rows, int cols,
+                    const float* const* in, float* const* out, int n,
+                    const int* rowList = nullptr);
+    void lstm_step(const int* rows, const float* const* inputs, const float* const* projected, int n);
+    void dense(const int* rows, int n);
+    int sample(float* logits, const SamplingConfig& sampling, const PenaltyTracker* penalties);
 };
 
 #endif
@@ -0,0 +1,176 @@
+#include "KernelTuner.h"
+#include <Preferences.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_ota_ops.h"
+#endif
+
+// Largest staged tile: one LSTM unit, two, and the whole staging buffer
+static const int TILE_CANDIDATES[] = {
+    LSTM_FUSED_COLS(LSTM_UNITS), 2 * LSTM_FUSED_COLS(LSTM_UNITS), WEIGHT_TILE_FLOATS,
+};
+
+// What is kept in NVS
+struct StoredTuning {
+    uint32_t modelHash;
+    uint32_t firmwareHash;
+    KernelConfig config;
+};
+
+KernelTuner::KernelTuner(DogberryAI_Word& ai) : ai(ai) {}
+
+void KernelTuner::begin() {
+    KernelConfig config;
+    bool stored = load(&config);
+    if (stored && ai.applyKernelConfig(config)) {
+        Serial.print("Kernel settings from NVS: ");
+    } else {
+        // The stored settings may want a PSRAM copy that no longer fits
+        Serial.println(stored ? "Stored kernel settings can't be applied, tuning..."
+                              : "No kernel settings for this model and firmware, tuning...");
+        if (!tune()) {
+            return;
+        }
+        Serial.print("Kernel settings tuned: ");
+    }
+    const KernelConfig& applied = ai.kernelConfig();
+    Serial.print(applied.streamWeights ? "staged tiles of " : "direct reads, tiles of ");
+    Serial.print(applied.tileFloats);
+    Serial.print(" floats, unroll ");
+    Serial.print(applied.unroll);
+    Serial.println(applied.denseInPsram || ai.denseKernelInPsram() ? ", dense weights in PSRAM"
+                                                                   : ", dense weights in flash");
+}
+
+uint32_t KernelTuner::firmwareHash() const {
+    // The app image's ELF SHA-256 changes with every build
+    char id[65];
+#ifdef ESP_PLATFORM
+    esp_ota_get_app_elf_sha256(id, sizeof(id));
+#else
+    snprintf(id, sizeof(id), "%s %s", __DATE__, __TIME__);
+#endif
+    uint32_t hash = 2166136261u;
+    for (const char* p = id; *p; p++) {
+        hash ^= (uint8_t)*p;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool KernelTuner::load(KernelConfig* config) {
+    Preferences prefs;
+    if (!prefs.begin(TUNE_NVS_NAMESPACE, true)) {
+        return false;
+    }
+    StoredTuning stored;
+    bool found = prefs.getBytesLength("tuning") == sizeof(stored) &&
+                 prefs.getBytes("tuning", &stored, sizeof(stored)) == sizeof(stored);
+    prefs.end();
+
+    if (!found || stored.modelHash != ai.modelHash() || stored.firmwareHash != firmwareHash()) {
+        return false;
+    }
+    *config = stored.config;
+    return true;
+}
+
+void KernelTuner::store(const KernelConfig& config) {
+    StoredTuning stored;
+    stored.modelHash = ai.modelHash();
+    stored.firmwareHash = firmwareHash();
+    stored.config = config;
+
+    Preferences prefs;
+    if (!prefs.begin(TUNE_NVS_NAMESPACE, false)) {
+        Serial.println("Failed to open NVS for kernel settings");
+        return;
+    }
+    prefs.putBytes("tuning", &stored, sizeof(stored));
+    prefs.end();
+}
+
+bool KernelTuner::tune() {
+    // Candidates: placement x unroll x (direct reads, or staged tiles of
+    // each size). The default settings come first and are the reference.
+    // A dense kernel already in PSRAM is read in place either way, so only
+    // one placement is timed.
+    KernelConfig candidates[2 * 2 * (1 + sizeof(TILE_CANDIDATES) / sizeof(TILE_CANDIDATES[0]))];
+    int count = 0;
+    candidates[count++] = KernelConfig();
+    int placements = ai.denseKernelInPsram() ? 1 : 2;
+    for (int placement = 0; placement < placements; placement++) {
+        for (int unroll = 1; unroll <= 4; unroll += 3) {
+            KernelConfig config;
+            config.denseInPsram = placement == 1;
+            config.unroll = unroll;
+            config.streamWeights = false;
+            candidates[count++] = config;
+            config.streamWeights = true;
+            for (int tile : TILE_CANDIDATES) {
+                config.tileFloats = tile;
+                // The default is already in the list
+                if (placement == 0 && unroll == 1 && tile == WEIGHT_TILE_FLOATS) {
+                    continue;
+                }
+                candidates[count++] = config;
+            }
+        }
+    }
+
+    // Size the runs from a quick timing of the default
+    KernelConfig previous = ai.kernelConfig();
+    ai.applyKernelConfig(candidates[0]);
+    float reference;
+    float usPerStep = ai.timeModelSteps(4, &reference);
+    if (usPerStep < 0.0f) {
+        Serial.println("Model busy with another response");
+        ai.applyKernelConfig(previous);
+        return false;
+    }
+    int steps = (int)(TUNE_MS_PER_CANDIDATE * 1000.0f / usPerStep);
+    if (steps < 4) {
+        steps = 4;
+    }
+    ai.timeModelSteps(steps, &reference);
+
+    int best = -1;
+    float bestUs = 0.0f;
+    for (int i = 0; i < count; i++) {
+        const KernelConfig& config = candidates[i];
+        if (!ai.applyKernelConfig(config)) {
+            continue;
+        }
+        float checksum;
+        float us = ai.timeModelSteps(steps, &checksum);
+
+        Serial.print(config.denseInPsram ? "  psram " : "  flash ");
+        Serial.print(config.streamWeights ? "tile " : "direct ");
+        if (config.streamWeights) {
+            Serial.print(config.tileFloats);
+            Serial.print(" ");
+        }
+        Serial.print("unroll ");
+        Serial.print(config.unroll);
+        Serial.print(": ");
+        Serial.print(us / 1000.0f, 2);
+        Serial.print(" ms/step");
+        if (checksum != reference) {
+            Serial.println(" (logits differ, not used)");
+            continue;
+        }
+        Serial.println();
+
+        if (best < 0 || us < bestUs) {
+            best = i;
+            bestUs = us;
+        }
+    }
+
+    if (best < 0 || !ai.applyKernelConfig(candidates[best])) {
+        ai.applyKernelConfig(previous);
+        return false;
+    }
+    store(candidates[best]);
+    return true;
+}
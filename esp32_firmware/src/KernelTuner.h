@@ -0,0 +1,40 @@
+#ifndef KERNEL_TUNER_H
+#define KERNEL_TUNER_H
+
+#include <Arduino.h>
+#include "DogberryAI_Word.h"
+
+// Time spent measuring each candidate KernelConfig
+#define TUNE_MS_PER_CANDIDATE 250
+
+// NVS namespace holding the tuned settings
+#define TUNE_NVS_NAMESPACE "kerneltune"
+
+// Picks the fastest KernelConfig for this board by timing model steps
+// with each candidate, and keeps the result in NVS. It is stored with a
+// hash of the model weights and of the firmware image, so flashing a new
+// model or build tunes again on the next boot:
+//
+//     KernelTuner tuner(ai);
+//     tuner.begin();   // Stored settings if still valid, else tune now
+//
+// Every candidate computes the same thing; one whose logits don't match
+// the default settings' is reported and never chosen.
+class KernelTuner {
+public:
+    explicit KernelTuner(DogberryAI_Word& ai);
+
+    void begin();
+
+    // Times every candidate, applies the fastest and stores it
+    bool tune();
+
+private:
+    DogberryAI_Word& ai;
+
+    uint32_t firmwareHash() const;
+    bool load(KernelConfig* config);
+    void store(const KernelConfig& config);
+};
+
+#endif
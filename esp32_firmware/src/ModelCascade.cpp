@@ -0,0 +1,129 @@
+#include "ModelCascade.h"
+
+ModelCascade::ModelCascade(DogberryAI_Word& full, DogberryAI_Word* fast,
+                           ConversationCache* conversations)
+    : fullGenerator(full, conversations),
+      fastGenerator(fast ? *fast : full, conversations),
+      current(MODEL_FULL), shortened(0) {
+    models[MODEL_FULL] = &full;
+    models[MODEL_FAST] = fast;
+    generators[MODEL_FULL] = &fullGenerator;
+    generators[MODEL_FAST] = &fastGenerator;
+    served[MODEL_FULL] = 0;
+    served[MODEL_FAST] = 0;
+}
+
+float ModelCascade::batchMs(Model model, int maxWords, uint32_t budgetMs) const {
+    // About maxWords generation steps, unless the time budget ends the
+    // batch first
+    float ms = maxWords * models[model]->tokenCostUs() / 1000.0f;
+    return budgetMs > 0 && ms > budgetMs ? budgetMs : ms;
+}
+
+float ModelCascade::predictMs(Model model, int backlog, int maxWords, uint32_t budgetMs) const {
+    int batches = (backlog + MAX_BATCH - 1) / MAX_BATCH;
+    return batches * batchMs(model, maxWords, budgetMs);
+}
+
+ModelCascade::Plan ModelCascade::plan(int backlog, const GenerationConfig& config) const {
+    Plan p;
+    p.model = MODEL_FULL;
+    p.maxWords = config.maxWords;
+    if (models[MODEL_FAST] && predictMs(MODEL_FULL, backlog, config.maxWords,
+                                        config.timeBudgetMs) > CASCADE_BACKLOG_TARGET_MS) {
+        p.model = MODEL_FAST;
+    }
+
+    // Still behind: shorten the replies so each batch fits its share of
+    // the target, down to CASCADE_MIN_WORDS
+    if (predictMs(p.model, backlog, config.maxWords, config.timeBudgetMs) >
+        CASCADE_BACKLOG_TARGET_MS) {
+        int batches = (backlog + MAX_BATCH - 1) / MAX_BATCH;
+        float perBatchMs = (float)CASCADE_BACKLOG_TARGET_MS / batches;
+        int words = (int)(perBatchMs * 1000.0f / models[p.model]->tokenCostUs());
+        p.maxWords = words < CASCADE_MIN_WORDS ? CASCADE_MIN_WORDS : words;
+        if (p.maxWords > config.maxWords) {
+            p.maxWords = config.maxWords;
+        }
+    }
+    p.predictedMs = predictMs(p.model, backlog, p.maxWords, config.timeBudgetMs);
+    return p;
+}
+
+bool ModelCascade::beginReplies(int backlog, const char* const* seedTexts, int count,
+                                const GenerationConfig& config, char* const* outs, int outSize,
+                                TokenCallback onToken, void* context,
+                                const ConversationRef* threads) {
+    Plan p = plan(backlog, config);
+    Model model = p.model;
+    GenerationConfig adapted = config;
+    adapted.maxWords = p.maxWords;
+
+    Serial.print("Replying with the ");
+    Serial.print(models[model]->modelName());
+    Serial.print(" model, up to ");
+    Serial.print(adapted.maxWords);
+    Serial.print(" words (");
+    Serial.print(backlog);
+    Serial.print(" mentions waiting, ~");
+    Serial.print(p.predictedMs / 1000.0f, 1);
+    Serial.println(" s to answer them)");
+
+    if (!generators[model]->beginBatch(seedTexts, count, adapted, outs, outSize, onToken, context,
+                                       threads)) {
+        return false;
+    }
+    current = model;
+    served[model] += count;
+    if (adapted.maxWords < config.maxWords) {
+        shortened += count;
+    }
+    return true;
+}
+
+bool ModelCascade::beginDailyPost(const char* seedText, const GenerationConfig& config, char* out,
+                                  int outSize, TokenCallback onToken, void* context) {
+    if (!fullGenerator.begin(seedText, config, out, outSize, onToken, context)) {
+        return false;
+    }
+    current = MODEL_FULL;
+    served[MODEL_FULL]++;
+    return true;
+}
+
+void ModelCascade::printStats() const {
+    Serial.print("Model cascade: ");
+    Serial.print(served[MODEL_FULL]);
+    Serial.print(" responses from the full model (");
+    Serial.print(models[MODEL_FULL]->lstmUnits());
+    Serial.print(" units, ~");
+    Serial.print(models[MODEL_FULL]->tokenCostUs() / 1000.0f, 1);
+    Serial.print(" ms/token), ");
+    if (models[MODEL_FAST]) {
+        Serial.print(served[MODEL_FAST]);
+        Serial.print(" from the fast model (");
+        Serial.print(models[MODEL_FAST]->lstmUnits());
+        Serial.print(" units, ~");
+        Serial.print(models[MODEL_FAST]->tokenCostUs() / 1000.0f, 1);
+        Serial.print(" ms/token), ");
+    } else {
+        Serial.print("no fast model, ");
+    }
+    Serial.print(shortened);
+    Serial.println(" replies shortened to keep up");
+}
+
+void ModelCascade::printPlan(int maxBacklog, const GenerationConfig& config) const {
+    Serial.print("Cascade plan (target ");
+    Serial.print(CASCADE_BACKLOG_TARGET_MS / 1000.0f, 1);
+    Serial.println(" s to answer the backlog):");
+    for (int backlog = 1; backlog <= maxBacklog; backlog += MAX_BATCH) {
+        // The largest backlog with this many batches
+        int shown = backlog + MAX_BATCH - 1 < maxBacklog ? backlog + MAX_BATCH - 1 : maxBacklog;
+        Plan p = plan(shown, config);
+        char line[96];
+        snprintf(line, sizeof(line), "  %2d mentions: %-4s model, %2d words, ~%.1f s", shown,
+                 models[p.model]->modelName(), p.maxWords, p.predictedMs / 1000.0f);
+        Serial.println(line);
+    }
+}
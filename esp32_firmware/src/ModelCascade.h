@@ -0,0 +1,76 @@
+#ifndef MODEL_CASCADE_H
+#define MODEL_CASCADE_H
+
+#include <Arduino.h>
+#include "DogberryAI_Word.h"
+#include "ConversationCache.h"
+#include "ResponseGenerator.h"
+
+// How long answering the whole backlog of mentions may take. A poll
+// returns at most 30 mentions (MENTION_FETCH_LIMIT), four batches, each
+// stopped by the reply time budget (3 s) at the latest: up to 12 s. Two
+// such batches fit, so bigger bursts move to the fast model.
+#define CASCADE_BACKLOG_TARGET_MS 6000
+
+// Replies are never cut shorter than this to meet the target
+#define CASCADE_MIN_WORDS 12
+
+// Chooses between the full model and a smaller, faster one for each
+// piece of work. Daily posts always use the full model. A batch of
+// replies uses the full model while the predicted time to answer every
+// waiting mention stays within CASCADE_BACKLOG_TARGET_MS, then the fast
+// model, and if even that falls behind, shorter replies. Each batch is
+// predicted to take maxWords steps at the model's measured per-token
+// cost, or the reply time budget if that is shorter:
+//
+//     if (cascade.beginReplies(backlog, seeds, count, config, outs, size)) {
+//         while (!cascade.generator().step(4)) { ... }
+//     }
+//
+// Without a fast model only the reply length adapts.
+class ModelCascade {
+public:
+    enum Model { MODEL_FULL, MODEL_FAST, MODEL_COUNT };
+
+    ModelCascade(DogberryAI_Word& full, DogberryAI_Word* fast, ConversationCache* conversations);
+
+    // backlog counts every mention still to be answered, this batch included
+    bool beginReplies(int backlog, const char* const* seedTexts, int count,
+                      const GenerationConfig& config, char* const* outs, int outSize,
+                      TokenCallback onToken = nullptr, void* context = nullptr,
+                      const ConversationRef* threads = nullptr);
+    bool beginDailyPost(const char* seedText, const GenerationConfig& config, char* out,
+                        int outSize, TokenCallback onToken = nullptr, void* context = nullptr);
+
+    // The generator of the work begun last
+    ResponseGenerator& generator() { return *generators[current]; }
+
+    void printStats() const;
+
+    // Prints the model and reply length chosen for each backlog up to
+    // maxBacklog, at the current token costs
+    void printPlan(int maxBacklog, const GenerationConfig& config) const;
+
+private:
+    DogberryAI_Word* models[MODEL_COUNT];
+    ResponseGenerator fullGenerator;
+    ResponseGenerator fastGenerator;
+    ResponseGenerator* generators[MODEL_COUNT];
+    Model current;
+
+    // Responses each model has produced, and replies shortened to keep up
+    uint32_t served[MODEL_COUNT];
+    uint32_t shortened;
+
+    struct Plan {
+        Model model;
+        int maxWords;
+        float predictedMs;
+    };
+
+    float batchMs(Model model, int maxWords, uint32_t budgetMs) const;
+    float predictMs(Model model, int backlog, int maxWords, uint32_t budgetMs) const;
+    Plan plan(int backlog, const GenerationConfig& config) const;
+};
+
+#endif
@@ -0,0 +1,575 @@
+#include "ModelContainer.h"
+#include <cstring>
+
+#ifdef ESP_PLATFORM
+#include "esp_idf_version.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Bits per element of each TensorDtype
+static const uint8_t DTYPE_BITS[] = {32, 8, 16, 32, 8, 16, 4};
+static const char* const DTYPE_NAMES[] = {"f32", "u8", "u16", "u32", "i8", "f16", "i4"};
+
+static float halfToFloat(uint16_t h) {
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    int exponent = (h >> 10) & 0x1F;
+    uint32_t mantissa = h & 0x3FF;
+    uint32_t bits;
+    if (exponent == 0x1F) {
+        bits = sign | 0x7F800000 | (mantissa << 13);  // Inf, NaN
+    } else if (exponent != 0) {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    } else if (mantissa == 0) {
+        bits = sign;
+    } else {
+        // Subnormal: renormalize
+        exponent = 113;
+        while (!(mantissa & 0x400)) {
+            mantissa <<= 1;
+            exponent--;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+    }
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static uint32_t crc32(const uint8_t* data, size_t len) {
+#ifdef ESP_PLATFORM
+    return esp_rom_crc32_le(0, data, len);
+#else
+    // Same polynomial and conditioning as zlib's crc32, which the packer uses
+    static uint32_t table[256];
+    if (table[1] == 0) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            }
+            table[i] = c;
+        }
+    }
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFF;
+#endif
+}
+
+ModelContainer::ModelContainer()
+    : base(nullptr), mappedBytes(0), expandedCount(0), expandedFrom(0), inflatedCount(0),
+      inflatedFrom(0), inflatedTo(0) {
+#ifdef ESP_PLATFORM
+    mapHandle = 0;
+#endif
+    memset(&bound, 0, sizeof(bound));
+    memset(name, 0, sizeof(name));
+}
+
+ModelContainer::~ModelContainer() {
+    close();
+}
+
+bool ModelContainer::open(const char* path) {
+    close();
+    unsigned long start = millis();
+    if (!map(path)) {
+        return false;
+    }
+    if (!validate()) {
+        close();
+        return false;
+    }
+    Serial.print("Model container mapped and checked in ");
+    Serial.print(millis() - start);
+    Serial.println(" ms");
+    printInfo();
+    return true;
+}
+
+void ModelContainer::close() {
+    if (base) {
+        unmap();
+    }
+    base = nullptr;
+    mappedBytes = 0;
+    memset(&bound, 0, sizeof(bound));
+    for (int i = 0; i < expandedCount; i++) {
+        free(expanded[i]);
+    }
+    expandedCount = 0;
+    expandedFrom = 0;
+    inflatedCount = 0;
+    inflatedFrom = 0;
+    inflatedTo = 0;
+}
+
+#ifdef ESP_PLATFORM
+bool ModelContainer::map(const char* path) {
+    (void)path;
+    const esp_partition_t* partition = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, MODEL_PARTITION_LABEL);
+    if (!partition) {
+        Serial.println("No \"" MODEL_PARTITION_LABEL "\" partition in the partition table");
+        return false;
+    }
+
+    // Read the header first and map only as much of the partition as the
+    // container fills: MMU pages are a scarce resource
+    ContainerHeader header;
+    if (esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK) {
+        Serial.println("Failed to read the model partition");
+        return false;
+    }
+    if (header.magic != CONTAINER_MAGIC) {
+        Serial.println("Model partition holds no model container (flash one with tools/pack_model.py)");
+        return false;
+    }
+    if (header.totalBytes < sizeof(header) || header.totalBytes > partition->size) {
+        Serial.println("Model container is larger than its partition");
+        return false;
+    }
+
+    const void* ptr;
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_partition_mmap_handle_t handle;
+    esp_err_t err = esp_partition_mmap(partition, 0, header.totalBytes, ESP_PARTITION_MMAP_DATA,
+                                       &ptr, &handle);
+#else
+    spi_flash_mmap_handle_t handle;
+    esp_err_t err = esp_partition_mmap(partition, 0, header.totalBytes, SPI_FLASH_MMAP_DATA,
+                                       &ptr, &handle);
+#endif
+    if (err != ESP_OK) {
+        Serial.println("Failed to memory-map the model partition");
+        return false;
+    }
+    base = (const uint8_t*)ptr;
+    mappedBytes = header.totalBytes;
+    mapHandle = handle;
+    return true;
+}
+
+void ModelContainer::unmap() {
+    esp_partition_munmap(mapHandle);
+}
+#else
+bool ModelContainer::map(const char* path) {
+    if (!path) {
+        Serial.println("No model container file given");
+        return false;
+    }
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        Serial.print("Failed to open ");
+        Serial.println(path);
+        return false;
+    }
+    struct stat st;
+    void* ptr = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (ptr == MAP_FAILED) {
+        Serial.print("Failed to memory-map ");
+        Serial.println(path);
+        return false;
+    }
+    base = (const uint8_t*)ptr;
+    mappedBytes = st.st_size;
+    return true;
+}
+
+void ModelContainer::unmap() {
+    munmap((void*)base, mappedBytes);
+}
+#endif
+
+const TensorEntry* ModelContainer::find(const char* tensor) const {
+    const ContainerHeader* header = (const ContainerHeader*)base;
+    const TensorEntry* table = (const TensorEntry*)(base + sizeof(ContainerHeader));
+    for (int i = 0; i < header->tensorCount; i++) {
+        if (strncmp(table[i].name, tensor, CONTAINER_NAME_BYTES) == 0) {
+            return &table[i];
+        }
+    }
+    return nullptr;
+}
+
+const TensorEntry* ModelContainer::check(const char* tensor, int rank, uint32_t d0, uint32_t d1,
+                                         uint32_t d2, TensorLayout layout, bool required) {
+    const TensorEntry* entry = find(tensor);
+    if (!entry) {
+        if (required) {
+            Serial.print("Model container has no ");
+            Serial.println(tensor);
+        }
+        return nullptr;
+    }
+    uint32_t dims[3] = {d0, d1, d2};
+    bool shapeOk = entry->rank == rank;
+    for (int i = 0; i < rank && shapeOk; i++) {
+        shapeOk = entry->dims[i] == dims[i];
+    }
+    if (entry->layout != layout || !shapeOk) {
+        Serial.print("Model container tensor ");
+        Serial.print(tensor);
+        Serial.println(" has the wrong layout or shape for this build");
+        return nullptr;
+    }
+    return entry;
+}
+
+const void* ModelContainer::bind(const char* tensor, TensorDtype dtype, int rank, uint32_t d0,
+                                 uint32_t d1, uint32_t d2) {
+    const TensorEntry* entry = check(tensor, rank, d0, d1, d2, LAYOUT_ROW_MAJOR, true);
+    if (!entry) {
+        return nullptr;
+    }
+    if (entry->dtype != dtype || entry->codec != CODEC_NONE) {
+        Serial.print("Model container tensor ");
+        Serial.print(tensor);
+        Serial.println(" has the wrong type, or is compressed");
+        return nullptr;
+    }
+    return base + entry->offset;
+}
+
+const float* ModelContainer::bindFloats(const char* tensor, int rank, uint32_t d0, uint32_t d1,
+                                        TensorLayout layout, bool required) {
+    const TensorEntry* entry = check(tensor, rank, d0, d1, 0, layout, required);
+    if (!entry) {
+        return nullptr;
+    }
+    switch (entry->dtype) {
+    case DTYPE_F32:
+        if (entry->codec == CODEC_NONE) {
+            return (const float*)(base + entry->offset);
+        }
+        return expand(entry, d0, rank > 1 ? d1 : 1);
+    case DTYPE_F16:
+    case DTYPE_I8:
+    case DTYPE_I4:
+        return expand(entry, d0, rank > 1 ? d1 : 1);
+    default:
+        Serial.print("Model container tensor ");
+        Serial.print(tensor);
+        Serial.println(" is not a float or quantized tensor");
+        return nullptr;
+    }
+}
+
+// Decodes a stored tensor into floats as its bytes arrive, straight from
+// the container or from the inflater's window
+struct Expansion {
+    const TensorEntry* entry;
+    const float* rowScales;  // nullptr: entry->scale for every row
+    uint32_t cols;
+    float* out;
+    size_t element;   // Next float to write
+    size_t count;
+    uint32_t col;
+    float scale;      // Of the current row
+    uint8_t pending[4];  // Bytes of a float or half split across chunks
+    int nPending;
+};
+
+static void putValue(Expansion& x, float q) {
+    // Quantized values are scaled as they are written
+    if (x.element >= x.count) {
+        return;  // Padding nibble
+    }
+    TensorDtype dtype = (TensorDtype)x.entry->dtype;
+    if (dtype == DTYPE_I8 || dtype == DTYPE_I4) {
+        q = x.scale * (q - x.entry->zeroPoint);
+    }
+    x.out[x.element++] = q;
+    if (++x.col == x.cols) {
+        x.col = 0;
+        if (x.rowScales && x.element < x.count) {
+            x.scale = x.rowScales[x.element / x.cols];
+        }
+    }
+}
+
+static void expandChunk(const uint8_t* data, size_t len, void* context) {
+    Expansion& x = *(Expansion*)context;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = data[i];
+        switch (x.entry->dtype) {
+        case DTYPE_I8:
+            putValue(x, (int8_t)b);
+            break;
+        case DTYPE_I4:
+            putValue(x, (b & 8) ? (int)(b & 0xF) - 16 : (b & 0xF));
+            putValue(x, (b & 0x80) ? (int)(b >> 4) - 16 : (b >> 4));
+            break;
+        case DTYPE_F16:
+            x.pending[x.nPending++] = b;
+            if (x.nPending == 2) {
+                putValue(x, halfToFloat(x.pending[0] | x.pending[1] << 8));
+                x.nPending = 0;
+            }
+            break;
+        default:  // DTYPE_F32
+            x.pending[x.nPending++] = b;
+            if (x.nPending == 4) {
+                float value;
+                memcpy(&value, x.pending, sizeof(value));
+                putValue(x, value);
+                x.nPending = 0;
+            }
+            break;
+        }
+    }
+}
+
+const float* ModelContainer::expand(const TensorEntry* entry, uint32_t rows, uint32_t cols) {
+    // The kernels only read floats, so quantized and compressed tensors
+    // are decoded into PSRAM once here
+    const float* rowScales = nullptr;
+    if (entry->dtype == DTYPE_I8 || entry->dtype == DTYPE_I4) {
+        char scaleName[CONTAINER_NAME_BYTES + 8];
+        snprintf(scaleName, sizeof(scaleName), "%s_scale", entry->name);
+        if (find(scaleName)) {
+            rowScales = (const float*)bind(scaleName, DTYPE_F32, 1, rows);
+            if (!rowScales) {
+                return nullptr;
+            }
+        }
+    }
+    float* out = (float*)ps_malloc((size_t)rows * cols * sizeof(float));
+    if (!out) {
+        Serial.print("No PSRAM to expand ");
+        Serial.println(entry->name);
+        return nullptr;
+    }
+    expanded[expandedCount++] = out;
+    expandedFrom += entry->bytes;
+
+    Expansion x;
+    memset(&x, 0, sizeof(x));
+    x.entry = entry;
+    x.rowScales = rowScales;
+    x.cols = cols;
+    x.out = out;
+    x.count = (size_t)rows * cols;
+    x.scale = rowScales ? rowScales[0] : entry->scale;
+
+    const uint8_t* data = base + entry->offset;
+    if (entry->codec == CODEC_NONE) {
+        expandChunk(data, entry->bytes, &x);
+        return out;
+    }
+    if (!inflater.inflate(data, entry->bytes, entry->rawBytes, expandChunk, &x)) {
+        Serial.print("Model container tensor ");
+        Serial.print(entry->name);
+        Serial.println(" does not decompress");
+        return nullptr;
+    }
+    inflatedCount++;
+    inflatedFrom += entry->bytes;
+    inflatedTo += entry->rawBytes;
+    return out;
+}
+
+bool ModelContainer::validate() {
+    const ContainerHeader* header = (const ContainerHeader*)base;
+    if (mappedBytes < sizeof(ContainerHeader) || header->magic != CONTAINER_MAGIC) {
+        Serial.println("Not a model container");
+        return false;
+    }
+    if (header->version < CONTAINER_MIN_VERSION || header->version > CONTAINER_VERSION) {
+        Serial.print("Model container version ");
+        Serial.print(header->version);
+        Serial.print(", this build reads versions ");
+        Serial.print(CONTAINER_MIN_VERSION);
+        Serial.print("-");
+        Serial.println(CONTAINER_VERSION);
+        return false;
+    }
+    size_t tableEnd = sizeof(ContainerHeader) + header->tensorCount * sizeof(TensorEntry);
+    if (header->totalBytes > mappedBytes || header->tensorCount > CONTAINER_MAX_TENSORS ||
+        tableEnd > header->totalBytes) {
+        Serial.println("Model container is truncated");
+        return false;
+    }
+    if (header->embeddingDim != EMBEDDING_DIM || header->seqLength != SEQ_LENGTH ||
+        header->lstmUnits == 0 || header->lstmUnits > LSTM_UNITS ||
+        header->lstmUnits % LSTM_UNITS_MULTIPLE != 0 || header->vocabSize <= TOKEN_START ||
+        header->vocabSize > MAX_VOCAB_SIZE) {
+        Serial.println("Model container dimensions do not fit this build");
+        return false;
+    }
+
+    // Every tensor inside the data area, aligned and as big as its shape
+    const TensorEntry* table = (const TensorEntry*)(base + sizeof(ContainerHeader));
+    for (int i = 0; i < header->tensorCount; i++) {
+        const TensorEntry& t = table[i];
+        uint64_t elements = 1;
+        for (int d = 0; d < t.rank && d < 3; d++) {
+            elements *= t.dims[d];
+        }
+        if (t.name[CONTAINER_NAME_BYTES - 1] != '\0' || t.dtype >= sizeof(DTYPE_BITS) ||
+            t.rank < 1 || t.rank > 3 || t.offset % CONTAINER_ALIGN != 0 || t.offset < tableEnd ||
+            (uint64_t)t.offset + t.bytes > header->totalBytes || t.codec > CODEC_DEFLATE ||
+            (elements * DTYPE_BITS[t.dtype] + 7) / 8 != (t.codec ? t.rawBytes : t.bytes)) {
+            Serial.print("Model container tensor ");
+            Serial.print(i);
+            Serial.println(" is malformed");
+            return false;
+        }
+    }
+
+    unsigned long crcStart = millis();
+    uint32_t crc = crc32(base + sizeof(ContainerHeader), header->totalBytes - sizeof(ContainerHeader));
+    if (crc != header->checksum) {
+        Serial.println("Model container checksum mismatch (partly flashed or corrupt)");
+        return false;
+    }
+    Serial.print("Model container checksum verified in ");
+    Serial.print(millis() - crcStart);
+    Serial.println(" ms");
+
+    // Bind the tensors
+    memcpy(name, header->name, sizeof(name) - 1);
+    name[sizeof(name) - 1] = '\0';
+    uint32_t V = header->vocabSize;
+    uint32_t U = header->lstmUnits;
+    ModelWeights w;
+    memset(&w, 0, sizeof(w));
+    w.name = name;
+    w.units = U;
+    unsigned long expandStart = millis();
+    w.lstmKernel = bindFloats("lstm_kernel", 2, EMBEDDING_DIM, 4 * U);
+    w.lstmBias = bindFloats("lstm_bias", 1, 4 * U);
+    w.denseKernel = bindFloats("dense_kernel", 2, U, V);
+    w.denseBias = bindFloats("dense_bias", 1, V);
+
+    // The recurrent weights in the Keras layout, or all the LSTM weights
+    // already interleaved for the fused kernel
+    if (find("lstm_fused")) {
+        w.lstmFused = bindFloats("lstm_fused", 2, U, LSTM_FUSED_COLS(U), LAYOUT_GATE_INTERLEAVED);
+        w.lstmFusedBias = bindFloats("lstm_fused_bias", 2, U, 4, LAYOUT_GATE_INTERLEAVED);
+        if (!w.lstmFused || !w.lstmFusedBias) {
+            return false;
+        }
+    } else {
+        w.lstmRecurrent = bindFloats("lstm_recurrent", 2, U, 4 * U);
+    }
+
+    // Full-precision embeddings, or product-quantized ones
+    const TensorEntry* codes = find("embedding_pq_codes");
+    if (codes) {
+        const TensorEntry* codebook = find("embedding_pq_codebook");
+        int subspaces = codes->dims[1];
+        int centroids = codebook && codebook->rank == 3 ? codebook->dims[1] : 0;
+        if (subspaces <= 0 || EMBEDDING_DIM % subspaces != 0 || centroids <= 0 || centroids > 256) {
+            Serial.println("Model container PQ embeddings do not fit this build");
+            return false;
+        }
+        w.pqSubspaces = subspaces;
+        w.pqCentroids = centroids;
+        w.embeddingCodes = (const uint8_t*)bind("embedding_pq_codes", DTYPE_U8, 2, V, subspaces);
+        w.embeddingCodebook = (const float*)bind("embedding_pq_codebook", DTYPE_F32, 3, subspaces,
+                                                 centroids, EMBEDDING_DIM / subspaces);
+    } else {
+        w.embedding = bindFloats("embedding", 2, V, EMBEDDING_DIM);
+    }
+    if (expandedCount > 0) {
+        Serial.print("Expanded ");
+        Serial.print(expandedCount);
+        Serial.print(" stored tensors (");
+        Serial.print(expandedFrom / 1024);
+        Serial.print(" KB) into PSRAM in ");
+        Serial.print(millis() - expandStart);
+        Serial.println(" ms");
+    }
+    if (inflatedCount > 0) {
+        Serial.print("  ");
+        Serial.print(inflatedCount);
+        Serial.print(" were compressed: ");
+        Serial.print(inflatedFrom / 1024);
+        Serial.print(" KB in flash for ");
+        Serial.print(inflatedTo / 1024);
+        Serial.print(" KB, ");
+        Serial.print((inflatedTo - inflatedFrom) / 1024);
+        Serial.println(" KB saved");
+    }
+
+    // The vocabulary
+    const TensorEntry* pool = find("vocab_pool");
+    w.vocabCount = V;
+    w.vocabPool = (const char*)bind("vocab_pool", DTYPE_U8, 1, pool ? pool->dims[0] : 0);
+    w.vocabOffsets = (const vocab_offset_t*)bind("vocab_offsets", DTYPE_U32, 1, V + 1);
+    w.vocabSorted = (const uint16_t*)bind("vocab_sorted", DTYPE_U16, 1, V);
+
+    if (!w.lstmKernel || (!w.lstmRecurrent && !w.lstmFused) || !w.lstmBias || !w.denseKernel ||
+        !w.denseBias ||
+        (!w.embedding && !w.embeddingCodes) || (w.embeddingCodes && !w.embeddingCodebook) ||
+        !w.vocabPool || !w.vocabOffsets || !w.vocabSorted) {
+        return false;
+    }
+
+    // Every word must lie inside the pool and be NUL-terminated, and the
+    // sorted index must only name real words, or a lookup could run off
+    // the end of the container
+    uint32_t poolBytes = pool->dims[0];
+    if (w.vocabOffsets[0] != 0 || w.vocabOffsets[V] != poolBytes) {
+        Serial.println("Model container vocabulary is malformed");
+        return false;
+    }
+    for (uint32_t i = 0; i < V; i++) {
+        uint32_t end = w.vocabOffsets[i + 1];
+        if (end <= w.vocabOffsets[i] || end > poolBytes || w.vocabPool[end - 1] != '\0' ||
+            w.vocabSorted[i] >= V) {
+            Serial.println("Model container vocabulary is malformed");
+            return false;
+        }
+    }
+
+    bound = w;
+    return true;
+}
+
+void ModelContainer::printInfo() const {
+    if (!base) {
+        Serial.println("No model container open");
+        return;
+    }
+    const ContainerHeader* header = (const ContainerHeader*)base;
+    Serial.print("Model container \"");
+    Serial.print(name);
+    Serial.print("\" v");
+    Serial.print(header->version);
+    Serial.print(": ");
+    Serial.print(header->totalBytes / 1024);
+    Serial.print(" KB, ");
+    Serial.print(header->vocabSize);
+    Serial.print(" words, ");
+    Serial.print(header->lstmUnits);
+    Serial.print(" LSTM units, ");
+    Serial.println(bound.pqSubspaces > 0 ? "PQ embeddings" : "full-precision embeddings");
+
+    const TensorEntry* table = (const TensorEntry*)(base + sizeof(ContainerHeader));
+    for (int i = 0; i < header->tensorCount; i++) {
+        char line[128];
+        int n = snprintf(line, sizeof(line), "  %-22s %-3s +%-8u %9u bytes", table[i].name,
+                         DTYPE_NAMES[table[i].dtype], (unsigned)table[i].offset,
+                         (unsigned)table[i].bytes);
+        if (table[i].codec == CODEC_DEFLATE) {
+            snprintf(line + n, sizeof(line) - n, " (deflated from %u)",
+                     (unsigned)table[i].rawBytes);
+        }
+        Serial.println(line);
+    }
+}
@@ -0,0 +1,139 @@
+#ifndef MODEL_CONTAINER_H
+#define MODEL_CONTAINER_H
+
+#include <Arduino.h>
+#include "DogberryAI_Word.h"
+#include "StreamInflater.h"
+
+// Flash partition holding the container (see partitions_container.csv)
+#define MODEL_PARTITION_LABEL "model"
+
+// Container format; bump the version whenever the layout below changes
+#define CONTAINER_MAGIC 0x4D424744  // "DGBM", little-endian
+#define CONTAINER_VERSION 2
+#define CONTAINER_MIN_VERSION 1     // Oldest still read: version 1 had no codecs
+#define CONTAINER_ALIGN 16          // Of every tensor's data
+#define CONTAINER_MAX_TENSORS 24
+#define CONTAINER_NAME_BYTES 24
+
+enum TensorDtype : uint8_t {
+    DTYPE_F32 = 0,
+    DTYPE_U8 = 1,
+    DTYPE_U16 = 2,
+    DTYPE_U32 = 3,
+    DTYPE_I8 = 4,    // value = scale * (q - zeroPoint), see TensorEntry
+    DTYPE_F16 = 5,
+    DTYPE_I4 = 6,    // As DTYPE_I8, two to a byte, low nibble first
+};
+
+enum TensorLayout : uint8_t {
+    LAYOUT_ROW_MAJOR = 0,         // As Keras exports it
+    LAYOUT_GATE_INTERLEAVED = 1,  // Each LSTM unit's gates adjacent, as the fused kernel reads them
+};
+
+// How a tensor's data is stored. Compressed tensors are decoded into PSRAM
+// at load, so only weights the kernels read as floats may be compressed.
+enum TensorCodec : uint8_t {
+    CODEC_NONE = 0,
+    CODEC_DEFLATE = 1,  // zlib stream
+};
+
+// A model in one binary file: this header, a table of tensorCount
+// TensorEntry, then the tensors' data. All integers are little-endian and
+// all offsets are from the start of the container.
+struct ContainerHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t tensorCount;
+    uint32_t totalBytes;    // Header, tensor table and data
+    uint32_t checksum;      // CRC-32 of everything after the header
+    char name[16];          // NUL-terminated
+    uint16_t vocabSize;
+    uint16_t embeddingDim;
+    uint16_t lstmUnits;
+    uint16_t seqLength;
+    uint8_t reserved[24];
+};
+
+struct TensorEntry {
+    char name[CONTAINER_NAME_BYTES];  // NUL-terminated
+    uint8_t dtype;   // TensorDtype
+    uint8_t layout;  // TensorLayout
+    uint8_t rank;    // Dimensions used, 1-3
+    uint8_t codec;   // TensorCodec
+    uint32_t dims[3];
+    uint32_t offset;
+    uint32_t bytes;     // Stored, so compressed if codec is set
+    // Quantization parameters (DTYPE_I8, DTYPE_I4). A tensor named
+    // <name>_scale, if present, holds one scale per row (dims[0]) instead.
+    float scale;
+    int32_t zeroPoint;
+    uint32_t rawBytes;  // Decoded size of a compressed tensor
+    uint32_t reserved;
+};
+
+static_assert(sizeof(ContainerHeader) == 64, "ContainerHeader layout changed");
+static_assert(sizeof(TensorEntry) == 64, "TensorEntry layout changed");
+
+// A model loaded from a container (written by tools/pack_model.py) rather
+// than compiled in, so a new model only needs the partition reflashed:
+//
+//     ModelContainer container;
+//     if (container.open()) {
+//         DogberryAI_Word ai(container.weights());
+//     }
+//
+// The container is memory-mapped, from the flash partition on the device
+// and from a file on Linux, and float tensors are used in place; quantized
+// and compressed ones (tools/compile_model.py) are expanded into PSRAM,
+// streaming through a small window. open() checks the format, the
+// dimensions against this build, every tensor's bounds and shape, and the
+// checksum before anything is bound.
+class ModelContainer {
+public:
+    ModelContainer();
+    ~ModelContainer();
+
+    // Maps the MODEL_PARTITION_LABEL partition (device) or the file at
+    // path (host); false, with the reason logged, if it is not a valid
+    // container for this build
+    bool open(const char* path = nullptr);
+    void close();
+
+    // Valid after a successful open(), until close()
+    const ModelWeights* weights() const { return &bound; }
+
+    void printInfo() const;
+
+private:
+    const uint8_t* base;
+    size_t mappedBytes;
+#ifdef ESP_PLATFORM
+    uint32_t mapHandle;
+#endif
+    ModelWeights bound;
+    char name[16];
+
+    // PSRAM copies of quantized or compressed tensors, as floats
+    float* expanded[CONTAINER_MAX_TENSORS];
+    int expandedCount;
+    size_t expandedFrom;  // Bytes of the stored tensors they came from
+    int inflatedCount;    // Of which compressed
+    size_t inflatedFrom;  // Their compressed and decoded sizes
+    size_t inflatedTo;
+    StreamInflater inflater;
+
+    bool map(const char* path);
+    void unmap();
+    bool validate();
+    const TensorEntry* find(const char* tensor) const;
+    const TensorEntry* check(const char* tensor, int rank, uint32_t d0, uint32_t d1, uint32_t d2,
+                             TensorLayout layout, bool required);
+    const void* bind(const char* tensor, TensorDtype dtype, int rank, uint32_t d0,
+                     uint32_t d1 = 0, uint32_t d2 = 0);
+    const float* bindFloats(const char* tensor, int rank, uint32_t d0, uint32_t d1 = 0,
+                            TensorLayout layout = LAYOUT_ROW_MAJOR, bool required = true);
+    const float* expand(const TensorEntry* entry, uint32_t rows, uint32_t cols);
+};
+
+#endif
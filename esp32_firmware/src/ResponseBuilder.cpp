@@ -0,0 +1,107 @@
+#include "ResponseBuilder.h"
+
+ResponseBuilder::ResponseBuilder()
+    : buffer(nullptr), capacity(0) {
+    reset();
+}
+
+ResponseBuilder::ResponseBuilder(char* buffer, int capacity)
+    : buffer(buffer), capacity(capacity) {
+    reset();
+}
+
+void ResponseBuilder::attach(char* buffer, int capacity) {
+    this->buffer = buffer;
+    this->capacity = capacity;
+    reset();
+}
+
+void ResponseBuilder::reset() {
+    len = 0;
+    graphemeCount = 0;
+    boundaryLen = 0;
+    boundaryGraphemes = 0;
+    capitalizeNext = true;
+    leadChecked = false;
+    if (capacity > 0) {
+        buffer[0] = '\0';
+    }
+}
+
+// Lowercase comparison of a word against an ASCII literal
+static bool wordEquals(const char* word, int len, const char* literal) {
+    int i = 0;
+    for (; i < len; i++) {
+        if (literal[i] == '\0' || tolower((uint8_t)word[i]) != literal[i]) {
+            return false;
+        }
+    }
+    return literal[i] == '\0';
+}
+
+bool ResponseBuilder::append(const char* word, int wordLen, int maxGraphemes) {
+    if (wordLen <= 0) {
+        return true;
+    }
+
+    bool punctuation = wordLen == 1 && ispunct((uint8_t)word[0]);
+    bool sentenceEnd = punctuation && (word[0] == '.' || word[0] == '!' || word[0] == '?');
+
+    // Nothing for punctuation to attach to yet, and the model sometimes
+    // echoes a greeting or its own name before the actual reply
+    if (!leadChecked) {
+        if (punctuation) {
+            return true;
+        }
+        leadChecked = true;
+        if (wordEquals(word, wordLen, "dogberry") || wordEquals(word, wordLen, "hey") ||
+            wordEquals(word, wordLen, "hello")) {
+            return true;
+        }
+    }
+
+    // Punctuation attaches to the previous word; words get a separating space
+    int space = (len > 0 && !punctuation) ? 1 : 0;
+    int added = space + countGraphemes(word, wordLen);
+    if (len + space + wordLen >= capacity || graphemeCount + added > maxGraphemes) {
+        return false;
+    }
+
+    if (space) {
+        buffer[len++] = ' ';
+    }
+    memcpy(buffer + len, word, wordLen);
+    if (capitalizeNext && !punctuation) {
+        buffer[len] = toupper((uint8_t)buffer[len]);
+        capitalizeNext = false;
+    }
+    len += wordLen;
+    buffer[len] = '\0';
+    graphemeCount += added;
+
+    if (sentenceEnd) {
+        boundaryLen = len;
+        boundaryGraphemes = graphemeCount;
+        capitalizeNext = true;
+    }
+    return true;
+}
+
+int ResponseBuilder::countGraphemes(const char* text, int len) {
+    // Everything but UTF-8 continuation bytes starts a code point
+    int count = 0;
+    for (int i = 0; i < len; i++) {
+        if (((uint8_t)text[i] & 0xC0) != 0x80) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void ResponseBuilder::truncateToSentence() {
+    if (boundaryLen > 0) {
+        len = boundaryLen;
+        graphemeCount = boundaryGraphemes;
+        buffer[len] = '\0';
+    }
+}
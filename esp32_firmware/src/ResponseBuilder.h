@@ -0,0 +1,51 @@
+#ifndef RESPONSE_BUILDER_H
+#define RESPONSE_BUILDER_H
+
+#include <Arduino.h>
+
+// Bluesky rejects post text longer than this many graphemes
+#define MAX_POST_GRAPHEMES 300
+
+// Assembles generated words into post text inside a caller-provided buffer.
+// The cleanup that used to happen afterwards is applied as words arrive:
+// punctuation attaches to the previous word, sentences start with a capital
+// and a leading "dogberry"/"hey"/"hello" is dropped. The buffer always holds
+// a NUL-terminated string; nothing is allocated.
+class ResponseBuilder {
+public:
+    ResponseBuilder();
+    ResponseBuilder(char* buffer, int capacity);
+
+    // Switches to another buffer and clears it
+    void attach(char* buffer, int capacity);
+    void reset();
+
+    // Appends a word. Returns false, leaving the text unchanged, if it would
+    // overflow the buffer or take the text past maxGraphemes.
+    bool append(const char* word, int len, int maxGraphemes);
+
+    // Cuts the text back to the end of the last complete sentence, if any
+    void truncateToSentence();
+
+    const char* c_str() const { return buffer ? buffer : ""; }
+    int length() const { return len; }
+    int graphemes() const { return graphemeCount; }
+    bool hasSentence() const { return boundaryLen > 0; }
+    bool atSentenceEnd() const { return boundaryLen > 0 && boundaryLen == len; }
+
+    // Graphemes in len bytes of UTF-8, counted as code points the way the
+    // post limit is checked everywhere
+    static int countGraphemes(const char* text, int len);
+
+private:
+    char* buffer;
+    int capacity;
+    int len;
+    int graphemeCount;
+    int boundaryLen;        // Length after the last . ! or ?
+    int boundaryGraphemes;
+    bool capitalizeNext;
+    bool leadChecked;       // First real word has been seen
+};
+
+#endif
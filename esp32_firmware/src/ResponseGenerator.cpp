@@ -0,0 +1,389 @@
+#include "ResponseGenerator.h"
+
+ResponseGenerator::ResponseGenerator(DogberryAI_Word& ai, ConversationCache* conversations)
+    : ai(ai), conversations(conversations), count(0), remaining(0) {}
+
+ResponseGenerator::~ResponseGenerator() {
+    if (ai.active_generator == this) {
+        ai.active_generator = nullptr;
+    }
+}
+
+bool ResponseGenerator::begin(const char* seedText, const GenerationConfig& config,
+                              char* out, int outSize, TokenCallback onToken, void* context) {
+    return beginBatch(&seedText, 1, config, &out, outSize, onToken, context);
+}
+
+bool ResponseGenerator::beginBatch(const char* const* seedTexts, int count,
+                                   const GenerationConfig& config, char* const* outs, int outSize,
+                                   TokenCallback onToken, void* context,
+                                   const ConversationRef* threads) {
+    if (count < 1 || count > MAX_BATCH) {
+        Serial.println("Invalid batch size");
+        return false;
+    }
+    if (ai.active_generator != nullptr && ai.active_generator != this) {
+        Serial.println("Model busy with another response");
+        return false;
+    }
+    ai.active_generator = this;
+
+    if (count == 1) {
+        Serial.println("Generating response...");
+    } else {
+        Serial.print("Generating ");
+        Serial.print(count);
+        Serial.println(" responses...");
+    }
+    this->config = config;
+    this->onToken = onToken;
+    this->context = context;
+    startUs = micros();
+    heapStart = ESP.getFreeHeap();
+    heapLowWater = heapStart;
+    firstTokenSeen = false;
+
+    // Resolve stop words to token ids once per batch
+    num_stop = 0;
+    for (int i = 0; i < MAX_STOP_TOKENS; i++) {
+        if (config.stopTokens[i] != nullptr) {
+            int idx = ai.tokenizeWord(config.stopTokens[i], strlen(config.stopTokens[i]));
+            if (idx != TOKEN_UNK) {
+                stop_ids[num_stop++] = idx;
+            }
+        }
+    }
+    usePenalties = config.sampling.penaltiesEnabled();
+
+    this->count = count;
+    remaining = count;
+    for (int s = 0; s < count; s++) {
+        Slot& slot = slots[s];
+        slot.response.attach(outs[s], outSize);
+        slot.seed_len = ai.tokenizeText(seedTexts[s], slot.seed_tokens, SEQ_LENGTH);
+        slot.threadKey = 0;
+        slot.resumed = false;
+        slot.projected = false;
+        if (threads && conversations && threads[s].threadId) {
+            resumeThread(s, seedTexts[s], threads[s]);
+        }
+        slot.attempt = 1;
+        slot.emitted = 0;
+        startAttempt(s);
+    }
+    lastTokenUs = micros();
+    return true;
+}
+
+void ResponseGenerator::resumeThread(int s, const char* seedText, const ConversationRef& thread) {
+    // On a hit the prefill continues the conversation: the token the last
+    // reply ended on, what was just said, then the usual seed
+    Slot& slot = slots[s];
+    slot.threadKey = ConversationCache::keyFor(thread.threadId);
+    int lastToken;
+    if (!conversations->load(slot.threadKey, ai.units, ai.rowH(s), ai.rowC(s), &lastToken)) {
+        ai.stats.conversationMisses++;
+        return;
+    }
+    ai.stats.conversationHits++;
+
+    int seed[SEQ_LENGTH];
+    int seedLen = ai.tokenizeText(seedText, seed, SEQ_LENGTH - 1);
+    int n = 0;
+    if (lastToken >= 0) {
+        slot.seed_tokens[n++] = lastToken;
+    }
+    if (thread.followUp) {
+        n += ai.tokenizeText(thread.followUp, slot.seed_tokens + n, SEQ_LENGTH - n - seedLen);
+    }
+    for (int i = 0; i < seedLen; i++) {
+        slot.seed_tokens[n++] = seed[i];
+    }
+    if (n > 0) {
+        slot.seed_len = n;
+        slot.resumed = true;
+    }
+}
+
+void ResponseGenerator::startAttempt(int s) {
+    Slot& slot = slots[s];
+    slot.next_token = -1;
+    slot.next_input = nullptr;
+    slot.unfed = -1;
+
+    // A resumed thread prefills from its cached state (reloaded, since an
+    // earlier attempt may have moved on from it)
+    int lastToken;
+    slot.logitsReady = false;
+    if (slot.resumed &&
+        conversations->load(slot.threadKey, ai.units, ai.rowH(s), ai.rowC(s), &lastToken)) {
+        slot.prefill_pos = 0;
+        slot.phase = PHASE_PREFILL;
+    } else {
+        // Resume from the cached state for known seeds, otherwise the seed
+        // is run through the LSTM a step at a time
+        slot.logitsReady = ai.restorePrefix(s, slot.seed_tokens, slot.seed_len);
+        if (slot.logitsReady) {
+            slot.phase = PHASE_GENERATE;
+        } else {
+            ai.resetState(s);
+            slot.prefill_pos = 0;
+            slot.phase = PHASE_PREFILL;
+        }
+    }
+
+    // The input side of every seed token is computed up front in one
+    // matrix product, leaving only the recurrent part for each prefill step.
+    // The seed is the same for every attempt, so this is done once.
+    if (slot.phase == PHASE_PREFILL && !slot.projected) {
+        ai.projectInputs(slot.seed_tokens, slot.seed_len, ai.rowPrefillInputs(s));
+        slot.projected = true;
+    }
+
+    // Penalties only look at what this response has generated so far
+    if (usePenalties) {
+        slot.penalties.reset();
+    }
+    slot.quality.reset();
+
+    // The builder tracks length in graphemes and the last sentence end as
+    // words arrive, so an over-long post can be cut back to a complete
+    // sentence without re-scanning the text
+    slot.response.reset();
+    slot.sampled = 0;
+    slot.words = 0;
+    slot.tokensSinceBoundary = 0;
+}
+
+bool ResponseGenerator::budgetAllowsToken(const Slot& slot) const {
+    // Stop when the next token is not expected to finish before the
+    // deadline (only once there is some text, so a reply is never empty).
+    // At the end of a sentence, also stop if a whole further sentence is
+    // not expected to fit: it would only be cut off again.
+    int32_t remainingUs = (int32_t)(config.timeBudgetMs * 1000UL) - (int32_t)(micros() - startUs);
+    if (remainingUs < ai.token_cost_us) {
+        return false;
+    }
+    if (slot.response.atSentenceEnd() && remainingUs < ai.token_cost_us * ai.sentence_tokens) {
+        return false;
+    }
+    return true;
+}
+
+bool ResponseGenerator::step(int nTokens) {
+    for (int i = 0; i < nTokens && active(); i++) {
+        runStep();
+    }
+    return done();
+}
+
+void ResponseGenerator::runStep() {
+    int rows[MAX_BATCH];
+    int n = 0;
+
+    // Limits are checked first, so a response that is about to end does
+    // not cost a dense pass
+    for (int s = 0; s < count; s++) {
+        Slot& slot = slots[s];
+        slot.next_token = -1;
+        slot.next_input = nullptr;
+        if (slot.phase != PHASE_GENERATE) {
+            continue;
+        }
+        // Draws are capped too: words the builder drops (leading punctuation
+        // and greetings) don't count as words but still cost a dense pass
+        if (slot.words >= config.maxWords || slot.sampled >= 2 * config.maxWords) {
+            finish(s, true);
+            continue;
+        }
+        if (config.timeBudgetMs > 0 && slot.words > 0 && !budgetAllowsToken(slot)) {
+            Serial.println("Time budget exhausted");
+            ai.stats.budgetTruncated++;
+            slot.response.truncateToSentence();
+            finish(s, true);
+            continue;
+        }
+        if (!slot.logitsReady) {
+            rows[n++] = s;
+        }
+    }
+    if (n > 0) {
+        ai.computeLogits(rows, n);
+    }
+
+    // Slots still prefilling take their next seed token; the rest sample one
+    bool sampledAny = false;
+    bool appended = false;
+    for (int s = 0; s < count; s++) {
+        Slot& slot = slots[s];
+        if (slot.phase == PHASE_PREFILL) {
+            if (slot.prefill_pos < slot.seed_len) {
+                slot.next_input = ai.rowPrefillInputs(s) + slot.prefill_pos * ai.units * 4;
+                slot.next_token = slot.seed_tokens[slot.prefill_pos++];
+            }
+        } else if (slot.phase == PHASE_GENERATE) {
+            sampledAny = true;
+            appended |= generateToken(s);
+        }
+    }
+
+    // One LSTM step for every slot that has a token
+    int tokens[MAX_BATCH];
+    const float* projected[MAX_BATCH];
+    n = 0;
+    for (int s = 0; s < count; s++) {
+        if (slots[s].next_token >= 0) {
+            rows[n] = s;
+            tokens[n] = slots[s].next_token;
+            projected[n++] = slots[s].next_input;
+        }
+    }
+    if (n > 0) {
+        ai.feedTokens(rows, tokens, projected, n);
+    }
+
+    for (int s = 0; s < count; s++) {
+        Slot& slot = slots[s];
+        if (slot.phase == PHASE_PREFILL && slot.prefill_pos >= slot.seed_len) {
+            slot.phase = PHASE_GENERATE;
+        }
+    }
+
+    // Wall-clock time per step, including whatever ran between steps. Steps
+    // that only prefilled don't count towards the token cost.
+    uint32_t now = micros();
+    if (appended) {
+        float cost = (float)(now - lastTokenUs);
+        if (ai.token_cost_timed) {
+            ai.token_cost_us += TOKEN_COST_EWMA_ALPHA * (cost - ai.token_cost_us);
+        } else {
+            ai.token_cost_us = cost;  // The first real sample replaces the initial guess
+            ai.token_cost_timed = true;
+        }
+        lastTokenUs = now;
+    } else if (!sampledAny) {
+        lastTokenUs = now;
+    }
+
+    uint32_t freeHeap = ESP.getFreeHeap();
+    if (freeHeap < heapLowWater) {
+        heapLowWater = freeHeap;
+    }
+}
+
+bool ResponseGenerator::generateToken(int s) {
+    // Returns true if a word was drawn for the response, even one the
+    // builder dropped
+    Slot& slot = slots[s];
+    slot.logitsReady = false;  // sample() may modify logits in place
+
+    // Special tokens are never drawn, so a model that favours them cannot
+    // spend dense passes producing nothing
+    float* logits = ai.rowLogits(s);
+    logits[TOKEN_PAD] = -INFINITY;
+    logits[TOKEN_UNK] = -INFINITY;
+    logits[TOKEN_START] = -INFINITY;
+    int next_word_idx = ai.sample(logits, config.sampling,
+                                  usePenalties ? &slot.penalties : nullptr);
+    float logprob = ai.last_logprob;
+    slot.sampled++;
+
+    WordView next_word = ai.detokenizeWord(next_word_idx);
+    int before = slot.response.length();
+    if (!slot.response.append(next_word.data, next_word.length, config.maxGraphemes)) {
+        ai.stats.lengthTruncated++;
+        slot.response.truncateToSentence();
+        finish(s, true);
+        return false;
+    }
+    slot.unfed = next_word_idx;
+
+    // The builder drops leading punctuation and greetings; those are still
+    // fed to the model but are neither counted nor streamed
+    bool kept = slot.response.length() > before;
+    if (kept) {
+        slot.words++;
+        slot.tokensSinceBoundary++;
+        if (slot.response.atSentenceEnd()) {
+            ai.sentence_tokens += TOKEN_COST_EWMA_ALPHA * (slot.tokensSinceBoundary - ai.sentence_tokens);
+            slot.tokensSinceBoundary = 0;
+        }
+    }
+
+    if (onToken && kept) {
+        TokenEvent event;
+        event.token = next_word_idx;
+        event.text = next_word;
+        event.logprob = logprob;
+        event.elapsedUs = micros() - startUs;
+        event.index = slot.emitted;
+        event.attempt = slot.attempt;
+        event.slot = s;
+        if (!firstTokenSeen) {
+            ai.stats.lastFirstTokenUs = event.elapsedUs;
+            firstTokenSeen = true;
+        }
+        slot.emitted++;
+        if (!onToken(event, context)) {
+            ai.stats.cancelled++;
+            finish(s, true);
+            return true;
+        }
+    }
+
+    // A stop word only ends a response that has something in it
+    for (int i = 0; kept && i < num_stop; i++) {
+        if (next_word_idx == stop_ids[i]) {
+            finish(s, true);
+            return true;
+        }
+    }
+    if (usePenalties) {
+        slot.penalties.record(next_word_idx);
+    }
+
+    // The final attempt is never aborted so a response is always produced
+    if (!slot.quality.update(next_word_idx, logprob) && slot.attempt < QUALITY_MAX_ATTEMPTS) {
+        finish(s, false);
+        return true;
+    }
+
+    // Continue LSTM
+    slot.next_token = next_word_idx;
+    slot.unfed = -1;
+    return true;
+}
+
+void ResponseGenerator::finish(int s, bool completed) {
+    Slot& slot = slots[s];
+    ai.stats.tokensSampled += slot.sampled;
+
+    // Degenerate output: restart from a fresh RNG state
+    if (!completed) {
+        ai.stats.aborts++;
+        ai.stats.tokensWasted += slot.sampled;
+        Serial.print("Degenerate output after ");
+        Serial.print(slot.sampled);
+        Serial.println(" tokens, restarting...");
+        randomSeed(esp_random());
+        slot.attempt++;
+        startAttempt(s);
+        return;
+    }
+
+    ai.stats.responses++;
+    slot.phase = PHASE_DONE;
+    if (slot.threadKey != 0 && conversations) {
+        conversations->store(slot.threadKey, ai.units, ai.rowH(s), ai.rowC(s), slot.unfed);
+    }
+    if (--remaining > 0) {
+        return;
+    }
+
+    ai.stats.batches++;
+    uint32_t heapUsed = heapStart - heapLowWater;
+    if (heapUsed > ai.stats.heapPeakBytes) {
+        ai.stats.heapPeakBytes = heapUsed;
+    }
+    ai.active_generator = nullptr;
+}
@@ -0,0 +1,115 @@
+#ifndef RESPONSE_GENERATOR_H
+#define RESPONSE_GENERATOR_H
+
+#include <Arduino.h>
+#include "DogberryAI_Word.h"
+#include "ConversationCache.h"
+#include "ResponseBuilder.h"
+#include "SamplingState.h"
+
+// The thread a reply belongs to, for continuing from the state the bot's
+// previous reply in it ended in
+struct ConversationRef {
+    const char* threadId;  // Root URI of the thread
+    const char* followUp;  // Text just received in it; fed before the seed when resuming
+};
+
+// One response being generated, advanced a few model steps at a time so
+// the caller can do other work in between:
+//
+//     generator.begin(seed, config, buffer, sizeof(buffer));
+//     while (!generator.done()) {
+//         generator.step(4);
+//         ...other work...
+//     }
+//
+// A step is one LSTM step over a seed token or one generated token. The
+// model has a single set of state buffers, so only one generator can be
+// active per DogberryAI_Word at a time; begin() fails while another one is.
+//
+// beginBatch() generates up to MAX_BATCH responses at once, one per seed.
+// Each step then advances every response in the batch by one token, with
+// their hidden states stacked so the weights are read once for all of them.
+//
+// With a ConversationCache, responses given a ConversationRef resume from
+// their thread's cached state and store their final state when done.
+class ResponseGenerator {
+public:
+    explicit ResponseGenerator(DogberryAI_Word& ai, ConversationCache* conversations = nullptr);
+    ~ResponseGenerator();
+
+    bool begin(const char* seedText, const GenerationConfig& config, char* out, int outSize,
+               TokenCallback onToken = nullptr, void* context = nullptr);
+    bool beginBatch(const char* const* seedTexts, int count, const GenerationConfig& config,
+                    char* const* outs, int outSize,
+                    TokenCallback onToken = nullptr, void* context = nullptr,
+                    const ConversationRef* threads = nullptr);
+
+    // Runs up to nTokens steps; returns true once every response is complete
+    bool step(int nTokens);
+
+    bool done() const { return count > 0 && remaining == 0; }
+    bool active() const { return remaining > 0; }
+    int batchSize() const { return count; }
+    const char* result(int slot = 0) const { return slots[slot].response.c_str(); }
+    int resultLength(int slot = 0) const { return slots[slot].response.length(); }
+
+private:
+    enum Phase { PHASE_PREFILL, PHASE_GENERATE, PHASE_DONE };
+
+    // One response of the batch; it owns row `slot` of the model's state
+    struct Slot {
+        ResponseBuilder response;
+        Phase phase;
+
+        int seed_tokens[SEQ_LENGTH];
+        int seed_len;
+        int prefill_pos;
+        int next_token;  // Token to run through the LSTM this step, -1 = none
+        const float* next_input;  // Its precomputed input projection, if a seed token
+        bool projected;  // The model's prefill inputs for this slot hold the seed
+        int unfed;       // Last token added to the response but not run through the LSTM
+
+        uint64_t threadKey;  // 0 = not part of a cached conversation
+        bool resumed;        // Starts from the thread's cached state
+
+        int attempt;
+        int sampled;     // Tokens drawn by the current attempt
+        int words;       // Of those, words kept in the response
+        int emitted;     // Tokens passed to onToken across all attempts
+        bool logitsReady;
+        int tokensSinceBoundary;  // Words since the last sentence end
+
+        PenaltyTracker penalties;
+        QualityMonitor quality;
+    };
+
+    DogberryAI_Word& ai;
+    ConversationCache* conversations;
+    GenerationConfig config;
+    Slot slots[MAX_BATCH];
+    int count;
+    int remaining;  // Slots not yet done
+
+    int stop_ids[MAX_STOP_TOKENS];
+    int num_stop;
+    bool usePenalties;
+
+    TokenCallback onToken;
+    void* context;
+    bool firstTokenSeen;
+
+    uint32_t startUs;
+    uint32_t heapStart;
+    uint32_t heapLowWater;
+    uint32_t lastTokenUs;     // When the previous token (or the prefill) finished
+
+    void runStep();
+    void resumeThread(int s, const char* seedText, const ConversationRef& thread);
+    void startAttempt(int s);
+    bool generateToken(int s);
+    bool budgetAllowsToken(const Slot& slot) const;
+    void finish(int s, bool completed);
+};
+
+#endif
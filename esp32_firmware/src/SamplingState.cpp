@@ -0,0 +1,154 @@
+#include "SamplingState.h"
+
+PenaltyTracker::PenaltyTracker() {
+    reset();
+}
+
+void PenaltyTracker::reset() {
+    recent_head = 0;
+    recent_count = 0;
+    for (int i = 0; i < PENALTY_TABLE_SIZE; i++) {
+        penalty_keys[i] = -1;
+        penalty_counts[i] = 0;
+    }
+}
+
+// Home slot of a token in the penalty count table (Fibonacci hashing)
+static inline int penaltyHash(int idx) {
+    return (int)(((uint32_t)idx * 2654435761u) >> 26) & (PENALTY_TABLE_SIZE - 1);
+}
+
+int PenaltyTracker::slotOf(int idx) const {
+    // Returns the slot holding idx, or the empty slot where it would go.
+    // The table can never fill up since it has more slots than the window.
+    int slot = penaltyHash(idx);
+    while (penalty_keys[slot] != -1 && penalty_keys[slot] != idx) {
+        slot = (slot + 1) & (PENALTY_TABLE_SIZE - 1);
+    }
+    return slot;
+}
+
+void PenaltyTracker::remove(int idx) {
+    int hole = slotOf(idx);
+    if (penalty_keys[hole] != idx) {
+        return;
+    }
+
+    // Backward-shift deletion keeps probe chains intact without tombstones
+    penalty_keys[hole] = -1;
+    penalty_counts[hole] = 0;
+    int next = hole;
+    while (true) {
+        next = (next + 1) & (PENALTY_TABLE_SIZE - 1);
+        if (penalty_keys[next] == -1) {
+            break;
+        }
+        int home = penaltyHash(penalty_keys[next]);
+        bool stays = (hole <= next) ? (hole < home && home <= next)
+                                    : (hole < home || home <= next);
+        if (!stays) {
+            penalty_keys[hole] = penalty_keys[next];
+            penalty_counts[hole] = penalty_counts[next];
+            penalty_keys[next] = -1;
+            penalty_counts[next] = 0;
+            hole = next;
+        }
+    }
+}
+
+void PenaltyTracker::record(int idx) {
+    // Expire the oldest token once the window is full
+    if (recent_count == PENALTY_WINDOW) {
+        int oldest = recent_tokens[recent_head];
+        int slot = slotOf(oldest);
+        if (penalty_keys[slot] == oldest && --penalty_counts[slot] == 0) {
+            remove(oldest);
+        }
+    } else {
+        recent_count++;
+    }
+
+    recent_tokens[recent_head] = (int16_t)idx;
+    recent_head = (recent_head + 1) % PENALTY_WINDOW;
+
+    int slot = slotOf(idx);
+    if (penalty_keys[slot] == -1) {
+        penalty_keys[slot] = (int16_t)idx;
+    }
+    penalty_counts[slot]++;
+}
+
+void PenaltyTracker::apply(float* logits, const SamplingConfig& sampling) const {
+    // Only the (at most PENALTY_WINDOW) distinct recent tokens are touched
+    for (int slot = 0; slot < PENALTY_TABLE_SIZE; slot++) {
+        int idx = penalty_keys[slot];
+        if (idx < 0) {
+            continue;
+        }
+
+        float logit = logits[idx];
+        if (sampling.repetitionPenalty != 1.0f) {
+            logit = logit > 0.0f ? logit / sampling.repetitionPenalty
+                                 : logit * sampling.repetitionPenalty;
+        }
+        logit -= sampling.presencePenalty + sampling.frequencyPenalty * penalty_counts[slot];
+        logits[idx] = logit;
+    }
+}
+
+QualityMonitor::QualityMonitor() {
+    reset();
+}
+
+void QualityMonitor::reset() {
+    tokens = 0;
+    logprob_sum = 0.0f;
+    ngram_hash = 0;
+    ngram_repeats = 0;
+    ngram_head = 0;
+    ngram_count = 0;
+}
+
+bool QualityMonitor::update(int idx, float logprob) {
+    // Rolling polynomial hash over the last QUALITY_NGRAM tokens: drop the
+    // outgoing token's contribution, shift, add the incoming one
+    static const uint32_t BASE = 1000003u;
+    uint32_t basePow = 1;
+    for (int i = 1; i < QUALITY_NGRAM; i++) {
+        basePow *= BASE;
+    }
+
+    int slot = tokens % QUALITY_NGRAM;
+    if (tokens >= QUALITY_NGRAM) {
+        ngram_hash -= (uint32_t)(ngram_window[slot] + 1) * basePow;
+    }
+    ngram_window[slot] = (int16_t)idx;
+    ngram_hash = ngram_hash * BASE + (uint32_t)(idx + 1);
+
+    tokens++;
+    logprob_sum += logprob;
+
+    // Compare each complete n-gram against the recent ones
+    if (tokens >= QUALITY_NGRAM) {
+        for (int i = 0; i < ngram_count; i++) {
+            if (ngram_hashes[i] == ngram_hash) {
+                ngram_repeats++;
+                break;
+            }
+        }
+        ngram_hashes[ngram_head] = ngram_hash;
+        ngram_head = (ngram_head + 1) % QUALITY_NGRAM_HISTORY;
+        if (ngram_count < QUALITY_NGRAM_HISTORY) {
+            ngram_count++;
+        }
+    }
+
+    if (ngram_repeats >= QUALITY_MAX_NGRAM_REPEATS) {
+        return false;
+    }
+    if (tokens >= QUALITY_MIN_TOKENS &&
+        logprob_sum / tokens < QUALITY_MIN_AVG_LOGPROB) {
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,74 @@
+#ifndef SAMPLING_STATE_H
+#define SAMPLING_STATE_H
+
+#include <Arduino.h>
+
+// Repetition penalty history
+#define PENALTY_WINDOW 32         // Most recent generated tokens considered
+#define PENALTY_TABLE_SIZE 64     // Open-addressing slots (power of two, > PENALTY_WINDOW)
+
+// Degenerate-output detection
+#define QUALITY_MIN_TOKENS 8              // Tokens before the log-prob average is trusted
+#define QUALITY_MIN_AVG_LOGPROB -5.5f     // Abort when the running mean drops below this (nats)
+#define QUALITY_NGRAM 3                   // Length of n-grams checked for repeats
+#define QUALITY_NGRAM_HISTORY 32          // Recent n-gram hashes remembered
+#define QUALITY_MAX_NGRAM_REPEATS 2       // Abort once this many n-grams have repeated
+#define QUALITY_MAX_ATTEMPTS 3            // Restarts before accepting whatever comes out
+
+// Sampling parameters. The defaults reproduce plain temperature sampling;
+// penalties only cost anything when one of them is switched on.
+struct SamplingConfig {
+    float temperature = 0.8f;
+    float repetitionPenalty = 1.0f;  // > 1.0 divides positive / multiplies negative logits of recent tokens
+    float presencePenalty = 0.0f;    // Subtracted once from any token seen in the window
+    float frequencyPenalty = 0.0f;   // Subtracted per occurrence in the window
+
+    bool penaltiesEnabled() const {
+        return repetitionPenalty != 1.0f || presencePenalty != 0.0f || frequencyPenalty != 0.0f;
+    }
+};
+
+// Tokens generated recently by one response, for the repetition penalties:
+// a ring buffer plus a sparse count table (linear probing) so each token is
+// O(1) to add and expire
+class PenaltyTracker {
+public:
+    PenaltyTracker();
+
+    void reset();
+    void record(int idx);
+    void apply(float* logits, const SamplingConfig& sampling) const;
+
+private:
+    int16_t recent_tokens[PENALTY_WINDOW];
+    int recent_head;
+    int recent_count;
+    int16_t penalty_keys[PENALTY_TABLE_SIZE];    // -1 = empty slot
+    uint8_t penalty_counts[PENALTY_TABLE_SIZE];
+
+    int slotOf(int idx) const;
+    void remove(int idx);
+};
+
+// Online quality monitor for one attempt at a response
+class QualityMonitor {
+public:
+    QualityMonitor();
+
+    void reset();
+
+    // Returns false once the output looks degenerate
+    bool update(int idx, float logprob);
+
+private:
+    int tokens;
+    float logprob_sum;
+    int16_t ngram_window[QUALITY_NGRAM];
+    uint32_t ngram_hash;
+    uint32_t ngram_hashes[QUALITY_NGRAM_HISTORY];
+    int ngram_head;
+    int ngram_count;
+    int ngram_repeats;
+};
+
+#endif
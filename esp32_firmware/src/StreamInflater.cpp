@@ -0,0 +1,97 @@
+#include "StreamInflater.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#if CONFIG_IDF_TARGET_ESP32S3
+#include "esp32s3/rom/miniz.h"
+#else
+#include "esp32/rom/miniz.h"
+#endif
+static_assert(INFLATE_WINDOW_BYTES == TINFL_LZ_DICT_SIZE, "the window must be tinfl's dictionary");
+#else
+#include <zlib.h>
+#endif
+
+StreamInflater::StreamInflater() : window(nullptr), state(nullptr) {}
+
+StreamInflater::~StreamInflater() {
+    free(window);
+    free(state);
+}
+
+#ifdef ESP_PLATFORM
+bool StreamInflater::inflate(const uint8_t* in, size_t inBytes, size_t outBytes, InflateSink sink,
+                             void* context) {
+    if (!window) {
+        window = (uint8_t*)heap_caps_malloc(INFLATE_WINDOW_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        state = malloc(sizeof(tinfl_decompressor));
+        if (!window || !state) {
+            Serial.println("No memory for the inflater");
+            return false;
+        }
+    }
+    tinfl_decompressor* inflater = (tinfl_decompressor*)state;
+    tinfl_init(inflater);
+
+    // The window wraps: each call decodes up to its end, the chunk is
+    // handed on, and decoding continues from the start
+    size_t inPos = 0;
+    size_t windowPos = 0;
+    size_t produced = 0;
+    for (;;) {
+        size_t inChunk = inBytes - inPos;
+        size_t outChunk = INFLATE_WINDOW_BYTES - windowPos;
+        tinfl_status status = tinfl_decompress(inflater, in + inPos, &inChunk, window,
+                                               window + windowPos, &outChunk,
+                                               TINFL_FLAG_PARSE_ZLIB_HEADER);
+        inPos += inChunk;
+        produced += outChunk;
+        if (produced > outBytes) {
+            return false;
+        }
+        sink(window + windowPos, outChunk, context);
+        windowPos = (windowPos + outChunk) & (INFLATE_WINDOW_BYTES - 1);
+        if (status == TINFL_STATUS_DONE) {
+            return produced == outBytes;
+        }
+        if (status != TINFL_STATUS_HAS_MORE_OUTPUT) {
+            return false;  // Corrupt, or the input ended early
+        }
+    }
+}
+#else
+bool StreamInflater::inflate(const uint8_t* in, size_t inBytes, size_t outBytes, InflateSink sink,
+                             void* context) {
+    if (!window) {
+        window = (uint8_t*)malloc(INFLATE_WINDOW_BYTES);
+        state = calloc(1, sizeof(z_stream));
+        if (!window || !state) {
+            Serial.println("No memory for the inflater");
+            return false;
+        }
+    }
+    z_stream* stream = (z_stream*)state;
+    *stream = z_stream();
+    if (inflateInit(stream) != Z_OK) {
+        return false;
+    }
+    stream->next_in = (Bytef*)in;
+    stream->avail_in = inBytes;
+    size_t produced = 0;
+    int status = Z_OK;
+    while (status == Z_OK) {
+        stream->next_out = window;
+        stream->avail_out = INFLATE_WINDOW_BYTES;
+        status = ::inflate(stream, Z_NO_FLUSH);
+        size_t chunk = INFLATE_WINDOW_BYTES - stream->avail_out;
+        produced += chunk;
+        if (produced > outBytes) {
+            status = Z_DATA_ERROR;
+            break;
+        }
+        sink(window, chunk, context);
+    }
+    inflateEnd(stream);
+    return status == Z_STREAM_END && produced == outBytes;
+}
+#endif
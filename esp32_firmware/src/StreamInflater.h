@@ -0,0 +1,37 @@
+#ifndef STREAM_INFLATER_H
+#define STREAM_INFLATER_H
+
+#include <Arduino.h>
+
+// Decoded data passes through a ring buffer this big, deflate's longest
+// back-reference; it is all the decoder needs beyond its own state
+#define INFLATE_WINDOW_BYTES 32768
+
+// Receives the decoded data in order, a chunk at a time
+typedef void (*InflateSink)(const uint8_t* data, size_t len, void* context);
+
+// Decodes a zlib stream (as written by Python's zlib.compress) in one
+// pass, handing each decoded chunk to a sink instead of needing room for
+// the whole output:
+//
+//     StreamInflater inflater;
+//     inflater.inflate(compressed, compressedBytes, rawBytes, sink, context);
+//
+// Uses the miniz inflater in the ESP32 ROM; host builds use zlib. The
+// window lives in internal SRAM for as long as the inflater does.
+class StreamInflater {
+public:
+    StreamInflater();
+    ~StreamInflater();
+
+    // False if the stream is corrupt or does not decode to exactly
+    // outBytes
+    bool inflate(const uint8_t* in, size_t inBytes, size_t outBytes, InflateSink sink,
+                 void* context);
+
+private:
+    uint8_t* window;
+    void* state;  // tinfl_decompressor, or zlib's z_stream on the host
+};
+
+#endif
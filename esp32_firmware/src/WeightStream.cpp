@@ -0,0 +1,154 @@
+#include "WeightStream.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_async_memcpy.h"
+#include "esp_heap_caps.h"
+#include "soc/soc_memory_layout.h"
+#if CONFIG_IDF_TARGET_ESP32S3
+#include "esp32s3/rom/cache.h"
+#endif
+
+#define DMA_ALIGN 64  // PSRAM transfers must be aligned to the cache line
+
+// Runs in the GDMA interrupt once a tile has landed
+static bool IRAM_ATTR onCopyDone(async_memcpy_t driver, async_memcpy_event_t* event, void* arg) {
+    *(volatile bool*)arg = true;
+    return false;
+}
+#endif
+
+WeightStream::WeightStream()
+    : dma(nullptr), src(nullptr), rowList(nullptr), tileFloats(WEIGHT_TILE_FLOATS), rows(0),
+      cols(0), rowsPerTile(0), nextRow(0), current(0), staged(false), copying(false) {
+    buffers[0] = nullptr;
+    buffers[1] = nullptr;
+    copyDone[0] = true;
+    copyDone[1] = true;
+}
+
+WeightStream::~WeightStream() {
+#ifdef ESP_PLATFORM
+    if (dma) esp_async_memcpy_uninstall((async_memcpy_t)dma);
+    if (buffers[0]) heap_caps_free(buffers[0]);
+    if (buffers[1]) heap_caps_free(buffers[1]);
+#endif
+}
+
+bool WeightStream::begin() {
+#ifdef ESP_PLATFORM
+    for (int i = 0; i < 2; i++) {
+        buffers[i] = (float*)heap_caps_aligned_alloc(DMA_ALIGN, WEIGHT_TILE_FLOATS * sizeof(float),
+                                                     MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA);
+    }
+    if (!buffers[0] || !buffers[1]) {
+        Serial.println("No internal SRAM for weight staging, reading weights in place");
+        return false;
+    }
+
+    async_memcpy_config_t config = ASYNC_MEMCPY_DEFAULT_CONFIG();
+    config.psram_trans_align = DMA_ALIGN;
+    config.sram_trans_align = 4;
+    async_memcpy_t driver;
+    if (esp_async_memcpy_install(&config, &driver) != ESP_OK) {
+        Serial.println("Async memcpy unavailable, reading weights in place");
+        return false;
+    }
+    dma = driver;
+#endif
+    return true;
+}
+
+void WeightStream::setTileFloats(int floats) {
+    tileFloats = floats < 1 ? 1 : (floats > WEIGHT_TILE_FLOATS ? WEIGHT_TILE_FLOATS : floats);
+}
+
+void WeightStream::start(const float* weights, int rows, int cols, bool staged,
+                         const int* rowList) {
+    src = weights;
+    this->rowList = rowList;
+    this->rows = rows;
+    this->cols = cols;
+    this->staged = staged;
+    nextRow = 0;
+    current = 0;
+
+    if (!staged) {
+        rowsPerTile = rowList ? 1 : rows;
+        copying = false;
+        return;
+    }
+    rowsPerTile = rowList ? 1 : tileFloats / cols;
+    if (rowsPerTile < 1) {
+        rowsPerTile = 1;
+    }
+
+    // Only memory the GDMA can read is copied; flash is read in place
+    copying = false;
+#ifdef ESP_PLATFORM
+    copying = dma != nullptr && cols <= WEIGHT_TILE_FLOATS &&
+              ((uintptr_t)weights % DMA_ALIGN) == 0 &&
+              (esp_ptr_dma_capable(weights) || esp_ptr_dma_ext_capable(weights));
+#endif
+    stage(0, 0);
+}
+
+void WeightStream::stage(int buffer, int index) {
+    int n = rows - index < rowsPerTile ? rows - index : rowsPerTile;
+    const float* from = src + (rowList ? rowList[index] : index) * cols;
+    size_t bytes = (size_t)n * cols * sizeof(float);
+
+#ifdef ESP_PLATFORM
+    if (copying) {
+        copyDone[buffer] = false;
+        if (esp_async_memcpy((async_memcpy_t)dma, buffers[buffer], (void*)from, bytes,
+                             onCopyDone, (void*)&copyDone[buffer]) != ESP_OK) {
+            memcpy(buffers[buffer], from, bytes);
+            copyDone[buffer] = true;
+        }
+        return;
+    }
+#if CONFIG_IDF_TARGET_ESP32S3
+    // One preload runs at a time; if the last is still going, skip this one
+    if (Cache_DCache_Preload_Done()) {
+        Cache_Start_DCache_Preload((uint32_t)from, bytes, 0);
+    }
+#endif
+#else
+    // Host build: software prefetch stands in for the DMA copy
+    (void)buffer;
+    for (size_t offset = 0; offset < bytes; offset += 64) {
+        __builtin_prefetch((const char*)from + offset);
+    }
+#endif
+}
+
+void WeightStream::waitForCopy(int buffer) {
+    while (!copyDone[buffer]) {
+    }
+}
+
+const float* WeightStream::next(int* firstRow, int* nRows) {
+    if (nextRow >= rows) {
+        return nullptr;
+    }
+    int n = rows - nextRow < rowsPerTile ? rows - nextRow : rowsPerTile;
+
+    int row = rowList ? rowList[nextRow] : nextRow;
+    const float* tile;
+    if (copying) {
+        waitForCopy(current);
+        tile = buffers[current];
+    } else {
+        tile = src + row * cols;
+    }
+    *firstRow = row;
+    *nRows = n;
+    nextRow += n;
+
+    // Start on the following tile while the caller works on this one
+    if (staged && nextRow < rows) {
+        stage(current ^ 1, nextRow);
+    }
+    current ^= 1;
+    return tile;
+}
@@ -0,0 +1,67 @@
+#ifndef WEIGHT_STREAM_H
+#define WEIGHT_STREAM_H
+
+#include <Arduino.h>
+
+// Staging buffer size; two are allocated in internal SRAM. Tiles can be
+// made smaller at run time, down to one row.
+#define WEIGHT_TILE_FLOATS 4096
+
+// Feeds a row-major weight matrix to a kernel one tile of whole rows at a
+// time, getting the next tile on its way while the current one is used:
+//
+//     stream.start(weights, rows, cols, true);
+//     while ((tile = stream.next(&firstRow, &nRows)) != nullptr) {
+//         ...use rows firstRow..firstRow + nRows - 1, at tile + k * cols...
+//     }
+//
+// Weights in DMA-capable memory (PSRAM or internal RAM) are copied into a
+// pair of internal SRAM buffers with esp_async_memcpy, ping-ponging so one
+// tile is copied while the other is multiplied. Weights that DMA can't
+// reach (flash) are read in place, with the next tile preloaded into the
+// data cache. Host builds emulate this with software prefetch. With
+// staging off the whole matrix is returned as one tile.
+//
+// Given a row list, only those rows are returned, one per tile.
+class WeightStream {
+public:
+    WeightStream();
+    ~WeightStream();
+
+    // Allocates the staging buffers; without them tiles are read in place
+    bool begin();
+
+    // rows is the length of rowList when one is given
+    void start(const float* weights, int rows, int cols, bool staged,
+               const int* rowList = nullptr);
+
+    // Returns the next tile, or nullptr once all rows have been returned
+    const float* next(int* firstRow, int* nRows);
+
+    bool dmaAvailable() const { return dma != nullptr; }
+
+    // Largest tile handed out, in floats; at most WEIGHT_TILE_FLOATS
+    void setTileFloats(int floats);
+    int tileSize() const { return tileFloats; }
+
+private:
+    float* buffers[2];
+    void* dma;  // async_memcpy_t on ESP32, unused elsewhere
+    volatile bool copyDone[2];
+
+    const float* src;
+    const int* rowList;
+    int tileFloats;
+    int rows;
+    int cols;
+    int rowsPerTile;
+    int nextRow;  // Index into rowList when there is one
+    int current;
+    bool staged;
+    bool copying;  // This matrix goes through the staging buffers
+
+    void stage(int buffer, int index);
+    void waitForCopy(int buffer);
+};
+
+#endif
@@ -4,13 +4,36 @@
 #include "secrets.h"
 #include "BlueskyAPI.h"
 #include "DogberryAI_Word.h"
+#include "ConversationCache.h"
+#include "KernelTuner.h"
+#include "ModelCascade.h"
+#include "ModelContainer.h"
+#include "ResponseGenerator.h"
+
+// secrets.h may point the bot at another server, e.g. tools/mock_bluesky.py
+#ifndef BLUESKY_API_BASE
+#define BLUESKY_API_BASE BLUESKY_DEFAULT_API_BASE
+#endif
 
 BlueskyAPI* bluesky = nullptr;
 DogberryAI_Word* ai = nullptr;
+DogberryAI_Word* fastAi = nullptr;  // Smaller model for mention bursts, if built in
+ModelCascade* cascade = nullptr;
+ResponseGenerator* generator = nullptr;  // Of the work begun last (see ModelCascade)
+ConversationCache* conversations = nullptr;
+KernelTuner* tuner = nullptr;
+ModelContainer* container = nullptr;  // Source of the full model in MODEL_CONTAINER builds
 
 unsigned long lastCheckTime = 0;
 const unsigned long CHECK_INTERVAL = 60000; // 60 seconds
 
+// Time budget of each batch of replies. A poll's worth of mentions must be
+// able to exceed the cascade's target, or it would never switch models.
+const uint32_t REPLY_TIME_BUDGET_MS = 3000;
+static_assert((MENTION_FETCH_LIMIT + MAX_BATCH - 1) / MAX_BATCH * REPLY_TIME_BUDGET_MS >
+                  CASCADE_BACKLOG_TARGET_MS,
+              "CASCADE_BACKLOG_TARGET_MS is out of reach of a full poll of mentions");
+
 int lastPostDay = -1;
 
 const char* ntpServer = "pool.ntp.org";
@@ -32,6 +55,117 @@ const char* dailySeeds[] = {
 };
 const int numSeeds = 10;
 
+// Reply seed phrases, chosen by what the mention looks like
+const char* replySeeds[] = {
+    "i think that",          // Questions
+    "good morrow to thee",   // Greetings
+    "i shall assist thee",   // Requests for help
+    "thou art a",            // Insults
+    "marry i say"            // Anything else
+};
+const int numReplySeeds = 5;
+
+// Generation settings for daily posts and replies
+GenerationConfig dailyConfig;
+GenerationConfig replyConfig;
+
+// Generated post text, one buffer per response of a batch; reused for
+// every post. Daily posts use the first.
+char responseBuffers[MAX_BATCH][RESPONSE_BUFFER_SIZE];
+
+// Mentions from the last poll still to be answered, oldest first. They are
+// replied to MAX_BATCH at a time, and the next batch starts as soon as the
+// previous one is posted. Each batch is marked seen once it is posted.
+Mention pendingMentions[MENTION_FETCH_LIMIT];
+int mentionCount = 0;
+int nextMention = 0;
+int batchStart = 0;
+int batchCount = 0;
+
+// A reply that fails to post ends the burst, and the next poll starts
+// again from its mention; after this many failures it is skipped
+const int REPLY_POST_ATTEMPTS = 3;
+int replyPostFailures = 0;
+
+// Reply throughput for the current burst of mentions
+unsigned long burstStartMs = 0;
+int burstReplies = 0;
+
+// Generation runs a few tokens per loop() pass; what to do with the text
+// once it is done
+const int TOKENS_PER_LOOP = 4;
+enum PendingPost { POST_NONE, POST_DAILY, POST_REPLY };
+PendingPost pendingPost = POST_NONE;
+int streamAttempt = 0;
+
+// Echoes tokens to the serial log as they are generated (only the first
+// response of a batch, so they don't interleave)
+bool logToken(const TokenEvent& event, void* context) {
+    if (event.slot != 0) {
+        return true;
+    }
+    int* lastAttempt = (int*)context;
+    if (event.index == 0 || event.attempt != *lastAttempt) {
+        Serial.print(event.index == 0 ? "Streaming: " : "\nRestarted: ");
+        *lastAttempt = event.attempt;
+    }
+    Serial.print(event.text.data);
+    Serial.print(" ");
+    return true;
+}
+
+// Diagnostics typed into the serial monitor, one command per line
+void handleSerialCommand() {
+    if (!Serial.available()) {
+        return;
+    }
+
+    String command = Serial.readStringUntil('\n');
+    command.trim();
+
+    if (command == "selftest") {
+        ai->testTokenizer();
+    } else if (command == "bench") {
+        ai->benchmarkTokenizer();
+    } else if (command == "batchbench") {
+        ai->benchmarkBatch();
+    } else if (command == "prefillbench") {
+        ai->benchmarkPrefill();
+    } else if (command == "tilebench") {
+        ai->benchmarkStreaming();
+    } else if (command == "sparsebench") {
+        const float thresholds[] = {0.01f, 0.02f, 0.05f, 0.1f};
+        for (float threshold : thresholds) {
+            ai->benchmarkSparsity(threshold);
+        }
+    } else if (command.startsWith("sparsity ")) {
+        ai->setSparsityThreshold(command.substring(9).toFloat());
+        Serial.print("Sparsity threshold set to ");
+        Serial.println(ai->sparsityThreshold(), 3);
+    } else if (command == "autotune") {
+        if (!tuner->tune()) {
+            Serial.println("Autotune failed");
+        }
+    } else if (command == "model") {
+        if (container) {
+            container->printInfo();
+        } else {
+            Serial.println("Full model compiled in");
+        }
+    } else if (command == "stats") {
+        ai->printStats();
+        if (fastAi) {
+            fastAi->printStats();
+        }
+        cascade->printStats();
+    } else if (command == "cascade") {
+        cascade->printPlan(MENTION_FETCH_LIMIT, replyConfig);
+    } else if (command.length() > 0) {
+        Serial.println("Commands: selftest, bench, batchbench, prefillbench, tilebench, sparsebench, "
+                       "sparsity <threshold>, autotune, model, stats, cascade");
+    }
+}
+
 void setup() {
     Serial.begin(115200);
     delay(1000);
@@ -61,126 +195,312 @@ void setup() {
     }
 
     // Initialize AI model
+#ifdef MODEL_CONTAINER
+    // Built without the full model: it is mapped from the model partition
+    container = new ModelContainer();
+    if (!container->open()) {
+        Serial.println("ERROR: No valid model container in flash");
+        while (1) delay(1000);
+    }
+    ai = new DogberryAI_Word(container->weights());
+#else
     ai = new DogberryAI_Word();
+#endif
     if (!ai->initialize()) {
         Serial.println("ERROR: Failed to initialize AI model");
         while (1) delay(1000);
     }
 
+    // The cascade's fast model, if one was exported
+    if (DogberryAI_Word::fastModel()) {
+        fastAi = new DogberryAI_Word(DogberryAI_Word::fastModel());
+        if (!fastAi->initialize()) {
+            Serial.println("Fast model unavailable, using the full model only");
+            delete fastAi;
+            fastAi = nullptr;
+        }
+    }
+
+    // Thread states let follow-up replies continue the conversation
+    conversations = new ConversationCache();
+    if (!conversations->begin()) {
+        Serial.println("Conversation cache unavailable, follow-ups start from the seed");
+        delete conversations;
+        conversations = nullptr;
+    }
+    cascade = new ModelCascade(*ai, fastAi, conversations);
+    generator = &cascade->generator();
+
+    // Precompute the LSTM state for every fixed seed phrase (daily posts
+    // always use the full model)
+    unsigned long cacheStart = millis();
+    for (int i = 0; i < numSeeds; i++) {
+        ai->cacheSeed(dailySeeds[i]);
+    }
+    for (int i = 0; i < numReplySeeds; i++) {
+        ai->cacheSeed(replySeeds[i]);
+        if (fastAi) {
+            fastAi->cacheSeed(replySeeds[i]);
+        }
+    }
+    Serial.print("Seed states cached in ");
+    Serial.print(millis() - cacheStart);
+    Serial.println(" ms");
+
+    // Fastest kernel settings for this board; measured on the first boot
+    // of each build. Tuned last, so a PSRAM copy of the dense weights is
+    // only made from what the models, caches and seeds above left free.
+    tuner = new KernelTuner(*ai);
+    tuner->begin();
+
+    // The fast model shares the full model's kernel settings, bar the
+    // PSRAM copy of its dense weights
+    if (fastAi) {
+        KernelConfig config = ai->kernelConfig();
+        config.denseInPsram = false;
+        fastAi->applyKernelConfig(config);
+    }
+
     // Initialize Bluesky API
-    bluesky = new BlueskyAPI(BLUESKY_HANDLE, BLUESKY_APP_PASSWORD);
+    bluesky = new BlueskyAPI(BLUESKY_HANDLE, BLUESKY_APP_PASSWORD, BLUESKY_API_BASE);
     if (!bluesky->authenticate()) {
         Serial.println("ERROR: Failed to authenticate with Bluesky");
         while (1) delay(1000);
     }
 
+    // Mild penalties keep posts from looping on the same phrase
+    replyConfig.sampling.temperature = 0.8f;
+    replyConfig.sampling.repetitionPenalty = 1.3f;
+    replyConfig.sampling.presencePenalty = 0.2f;
+    replyConfig.sampling.frequencyPenalty = 0.3f;
+    replyConfig.maxWords = 40;
+    replyConfig.maxGraphemes = MAX_POST_GRAPHEMES;
+    replyConfig.timeBudgetMs = REPLY_TIME_BUDGET_MS;
+
+    // 30-40 words for a good daily quote, with no rush
+    dailyConfig = replyConfig;
+    dailyConfig.maxWords = 35;
+    dailyConfig.timeBudgetMs = 0;
+
     Serial.println("=== Dogberry Bot Ready ===\n");
 }
 
+// Picks a reply seed phrase from what the mention looks like
+const char* chooseReplySeed(const String& mentionText) {
+    // Extract user's message (remove @dogberry mention)
+    String cleanedMention = mentionText;
+    cleanedMention.replace("@dogberry", "");
+    cleanedMention.replace("@Dogberry", "");
+    cleanedMention.replace("@constabledogberry", "");
+    cleanedMention.trim();
+    cleanedMention.toLowerCase();
+
+    // Detect question patterns
+    if (cleanedMention.indexOf("?") != -1 ||
+        cleanedMention.startsWith("what") ||
+        cleanedMention.startsWith("who") ||
+        cleanedMention.startsWith("why") ||
+        cleanedMention.startsWith("how") ||
+        cleanedMention.startsWith("when") ||
+        cleanedMention.startsWith("where")) {
+        return replySeeds[0];
+    }
+    // Detect greetings
+    if (cleanedMention.indexOf("hello") != -1 ||
+        cleanedMention.indexOf("hi ") != -1 ||
+        cleanedMention.indexOf("hey") != -1 ||
+        cleanedMention.indexOf("greetings") != -1) {
+        return replySeeds[1];
+    }
+    // Detect requests for help
+    if (cleanedMention.indexOf("help") != -1) {
+        return replySeeds[2];
+    }
+    // Detect insults or negative sentiment
+    if (cleanedMention.indexOf("fool") != -1 ||
+        cleanedMention.indexOf("stupid") != -1 ||
+        cleanedMention.indexOf("idiot") != -1 ||
+        cleanedMention.indexOf("villain") != -1) {
+        return replySeeds[3];
+    }
+    // Default to general response
+    return replySeeds[4];
+}
+
+// Starts generating replies to the next batch of pending mentions
+void startReplyBatch() {
+    int count = mentionCount - nextMention;
+    if (count > MAX_BATCH) {
+        count = MAX_BATCH;
+    }
+
+    const char* seeds[MAX_BATCH];
+    char* outs[MAX_BATCH];
+    ConversationRef threads[MAX_BATCH];
+    for (int i = 0; i < count; i++) {
+        const Mention& mention = pendingMentions[nextMention + i];
+
+        // Create contextual seed
+        seeds[i] = chooseReplySeed(mention.text);
+        outs[i] = responseBuffers[i];
+        threads[i].threadId = mention.rootUri.c_str();
+        threads[i].followUp = mention.text.c_str();
+
+        Serial.print("Using seed: ");
+        Serial.println(seeds[i]);
+    }
+
+    streamAttempt = 0;
+    if (cascade->beginReplies(mentionCount - nextMention, seeds, count, replyConfig, outs,
+                              RESPONSE_BUFFER_SIZE, logToken, &streamAttempt, threads)) {
+        generator = &cascade->generator();
+        pendingPost = POST_REPLY;
+        batchStart = nextMention;
+        batchCount = count;
+        nextMention += count;
+    }
+}
+
+// Posts the responses the generator just finished
+void publishResponse() {
+    Serial.println();
+    ai->printStats();
+    if (fastAi) {
+        fastAi->printStats();
+    }
+    cascade->printStats();
+
+    if (pendingPost == POST_DAILY) {
+        Serial.print("Daily post generated: ");
+        Serial.println(generator->result());
+
+        // Post the AI-generated daily status
+        if (generator->result()[0] == '\0') {
+            Serial.println("Daily post is empty, not publishing\n");
+        } else if (bluesky->postStatus(generator->result())) {
+            Serial.println("Daily post published!\n");
+        } else {
+            Serial.println("Failed to publish daily post\n");
+        }
+    } else if (pendingPost == POST_REPLY) {
+        String answered;  // Newest mention of the batch dealt with
+        bool failed = false;
+        for (int i = 0; i < batchCount; i++) {
+            const Mention& mention = pendingMentions[batchStart + i];
+            Serial.print("Generated: ");
+            Serial.println(generator->result(i));
+
+            if (generator->result(i)[0] == '\0') {
+                Serial.println("Reply is empty, not posting it\n");
+                answered = mention.indexedAt;
+            } else if (bluesky->postReply(generator->result(i), mention)) {
+                Serial.println("Reply posted!\n");
+                burstReplies++;
+                replyPostFailures = 0;
+                answered = mention.indexedAt;
+            } else if (++replyPostFailures < REPLY_POST_ATTEMPTS) {
+                Serial.println("Failed to post reply, retrying from here on the next poll\n");
+                failed = true;
+                break;
+            } else {
+                Serial.println("Failed to post reply, giving up on this mention\n");
+                replyPostFailures = 0;
+                answered = mention.indexedAt;
+            }
+        }
+
+        // Later mentions wait for the next poll, so nothing is skipped or
+        // answered twice
+        if (failed) {
+            nextMention = mentionCount;
+        } else if (nextMention >= mentionCount) {
+            answered = bluesky->listedUntil();
+        }
+        bluesky->markSeen(answered);
+
+        if (nextMention >= mentionCount) {
+            float seconds = (millis() - burstStartMs) / 1000.0f;
+            Serial.print("Answered ");
+            Serial.print(burstReplies);
+            Serial.print(" of ");
+            Serial.print(mentionCount);
+            Serial.print(" mentions in ");
+            Serial.print(seconds, 1);
+            Serial.print(" s (");
+            Serial.print(seconds > 0.0f ? burstReplies * 60.0f / seconds : 0.0f, 1);
+            Serial.println(" replies/minute)\n");
+        }
+    }
+    pendingPost = POST_NONE;
+}
+
 void loop() {
     unsigned long currentTime = millis();
 
+    handleSerialCommand();
+
+    // Advance the response being generated a few tokens per pass, so the
+    // time and mention checks below keep running while it is produced
+    if (generator->active()) {
+        if (generator->step(TOKENS_PER_LOOP)) {
+            publishResponse();
+        }
+    }
+
     // Check current time for daily post
     struct tm timeinfo;
     if (getLocalTime(&timeinfo)) {
-        // Check if it's 20:00 UTC and we haven't posted today
+        // Check if it's 20:00 UTC and we haven't posted today. If a reply is
+        // still being generated, this is retried on the next pass.
         if (timeinfo.tm_hour == 20 && timeinfo.tm_min == 0 &&
-            timeinfo.tm_mday != lastPostDay) {
+            timeinfo.tm_mday != lastPostDay && !generator->active()) {
 
             Serial.println("TIME FOR DAILY POST!");
             lastPostDay = timeinfo.tm_mday;
 
             // Pick a random seed phrase and generate AI content
             int seedIndex = random(0, numSeeds);
-            String seed = String(dailySeeds[seedIndex]);
+            const char* seed = dailySeeds[seedIndex];
 
             Serial.print("Daily post seed: ");
             Serial.println(seed);
 
-            // Generate AI response (30-40 words for a good daily quote)
-            String dailyPost = ai->generateResponse(seed, 35);
-
-            Serial.print("Daily post generated: ");
-            Serial.println(dailyPost);
-
-            // Post the AI-generated daily status
-            if (bluesky->postStatus(dailyPost)) {
-                Serial.println("Daily post published!\n");
-            } else {
-                Serial.println("Failed to publish daily post\n");
+            streamAttempt = 0;
+            if (cascade->beginDailyPost(seed, dailyConfig, responseBuffers[0],
+                                        RESPONSE_BUFFER_SIZE, logToken, &streamAttempt)) {
+                generator = &cascade->generator();
+                pendingPost = POST_DAILY;
             }
         }
     }
 
-    // Check for mentions every 60 seconds
-    if (currentTime - lastCheckTime >= CHECK_INTERVAL) {
+    // Keep answering the mentions from the last poll, a batch at a time
+    if (!generator->active() && nextMention < mentionCount) {
+        startReplyBatch();
+    }
+
+    // Check for mentions every 60 seconds, once the model is free and
+    // the previous poll's mentions are all answered
+    if (currentTime - lastCheckTime >= CHECK_INTERVAL && !generator->active() &&
+        nextMention >= mentionCount) {
         lastCheckTime = currentTime;
 
         Serial.println("Checking for mentions...");
 
-        String mentionText, replyUri, replyCid;
-        if (bluesky->checkMentions(mentionText, replyUri, replyCid)) {
-            Serial.println("Processing mention...");
-
-            // Extract user's message (remove @dogberry mention)
-            String cleanedMention = mentionText;
-            cleanedMention.replace("@dogberry", "");
-            cleanedMention.replace("@Dogberry", "");
-            cleanedMention.replace("@constabledogberry", "");
-            cleanedMention.trim();
-            cleanedMention.toLowerCase();
-
-            // Create contextual seed
-            String seed = "";
-
-            // Detect question patterns
-            if (cleanedMention.indexOf("?") != -1 ||
-                cleanedMention.startsWith("what") ||
-                cleanedMention.startsWith("who") ||
-                cleanedMention.startsWith("why") ||
-                cleanedMention.startsWith("how") ||
-                cleanedMention.startsWith("when") ||
-                cleanedMention.startsWith("where")) {
-                seed = "i think that";
-            }
-            // Detect greetings
-            else if (cleanedMention.indexOf("hello") != -1 ||
-                     cleanedMention.indexOf("hi ") != -1 ||
-                     cleanedMention.indexOf("hey") != -1 ||
-                     cleanedMention.indexOf("greetings") != -1) {
-                seed = "good morrow to thee";
-            }
-            // Detect requests for help
-            else if (cleanedMention.indexOf("help") != -1) {
-                seed = "i shall assist thee";
-            }
-            // Detect insults or negative sentiment
-            else if (cleanedMention.indexOf("fool") != -1 ||
-                     cleanedMention.indexOf("stupid") != -1 ||
-                     cleanedMention.indexOf("idiot") != -1 ||
-                     cleanedMention.indexOf("villain") != -1) {
-                seed = "thou art a";
-            }
-            // Default to general response
-            else {
-                seed = "marry i say";
-            }
-
-            Serial.print("Using seed: ");
-            Serial.println(seed);
-
-            String response = ai->generateResponse(seed, 40);
-
-            Serial.print("Generated: ");
-            Serial.println(response);
-
-            if (bluesky->postReply(response, replyUri, replyCid)) {
-                Serial.println("Reply posted!\n");
-            } else {
-                Serial.println("Failed to post reply\n");
-            }
+        mentionCount = bluesky->checkMentions(pendingMentions, MENTION_FETCH_LIMIT);
+        nextMention = 0;
+        if (mentionCount == 0) {
+            bluesky->markSeen(bluesky->listedUntil());
+        } else {
+            Serial.print("Processing ");
+            Serial.print(mentionCount);
+            Serial.println(" mentions...");
+            burstStartMs = millis();
+            burstReplies = 0;
+            startReplyBatch();
         }
     }
 
-    delay(100);
+    // Only idle when there is no generation to get on with
+    delay(generator->active() ? 1 : 100);
 }
@@ -0,0 +1,4515 @@
+// Generated by tools/gen_vocab.py from vocab_data_word.h - do not edit.
+#include <Arduino.h>
+#include "vocab_pool_word.h"
+
+// All words, NUL-terminated, back to back
+const char VOCAB_POOL[VOCAB_POOL_BYTES] PROGMEM =
+    "<PAD>\0"  // 0
+    "<UNK>\0"  // 1
+    "<START>\0"  // 2
+    ",\0"  // 3
+    "the\0"  // 4
+    "and\0"  // 5
+    "to\0"  // 6
+    "of\0"  // 7
+    ".\0"  // 8
+    "i\0"  // 9
+    "a\0"  // 10
+    ":\0"  // 11
+    "in\0"  // 12
+    "that\0"  // 13
+    "you\0"  // 14
+    "my\0"  // 15
+    "is\0"  // 16
+    "?\0"  // 17
+    "for\0"  // 18
+    "not\0"  // 19
+    "it\0"  // 20
+    "with\0"  // 21
+    "!\0"  // 22
+    "be\0"  // 23
+    "his\0"  // 24
+    "he\0"  // 25
+    "this\0"  // 26
+    "but\0"  // 27
+    "as\0"  // 28
+    "me\0"  // 29
+    "d\0"  // 30
+    "your\0"  // 31
+    "thou\0"  // 32
+    "him\0"  // 33
+    "so\0"  // 34
+    "will\0"  // 35
+    "what\0"  // 36
+    "haue\0"  // 37
+    "most\0"  // 38
+    "thy\0"  // 39
+    "all\0"  // 40
+    "by\0"  // 41
+    "her\0"  // 42
+    ";\0"  // 43
+    "if\0"  // 44
+    "are\0"  // 45
+    "no\0"  // 46
+    "was\0"  // 47
+    "s\0"  // 48
+    "shall\0"  // 49
+    "then\0"  // 50
+    "on\0"  // 51
+    "had\0"  // 52
+    "thee\0"  // 53
+    "do\0"  // 54
+    "they\0"  // 55
+    "or\0"  // 56
+    "man\0"  // 57
+    "which\0"  // 58
+    "good\0"  // 59
+    "from\0"  // 60
+    "at\0"  // 61
+    "we\0"  // 62
+    "our\0"  // 63
+    "now\0"  // 64
+    "would\0"  // 65
+    "who\0"  // 66
+    "lord\0"  // 67
+    "when\0"  // 68
+    "let\0"  // 69
+    "come\0"  // 70
+    "there\0"  // 71
+    "she\0"  // 72
+    "one\0"  // 73
+    "well\0"  // 74
+    "their\0"  // 75
+    "more\0"  // 76
+    "them\0"  // 77
+    "may\0"  // 78
+    "loue\0"  // 79
+    "should\0"  // 80
+    "am\0"  // 81
+    "an\0"  // 82
+    "how\0"  // 83
+    "sir\0"  // 84
+    "tis\0"  // 85
+    "say\0"  // 86
+    "did\0"  // 87
+    "o\0"  // 88
+    "hath\0"  // 89
+    "make\0"  // 90
+    "some\0"  // 91
+    "must\0"  // 92
+    "were\0"  // 93
+    "like\0"  // 94
+    "these\0"  // 95
+    "know\0"  // 96
+    "being\0"  // 97
+    "such\0"  // 98
+    "out\0"  // 99
+    "vpon\0"  // 100
+    "king\0"  // 101
+    "too\0"  // 102
+    "st\0"  // 103
+    "where\0"  // 104
+    "why\0"  // 105
+    "yet\0"  // 106
+    "selfe\0"  // 107
+    "vs\0"  // 108
+    "see\0"  // 109
+    "holmes\0"  // 110
+    "time\0"  // 111
+    "great\0"  // 112
+    "ile\0"  // 113
+    "any\0"  // 114
+    "day\0"  // 115
+    "giue\0"  // 116
+    "men\0"  // 117
+    "heere\0"  // 118
+    "go\0"  // 119
+    "can\0"  // 120
+    "take\0"  // 121
+    "night\0"  // 122
+    "doe\0"  // 123
+    "much\0"  // 124
+    "death\0"  // 125
+    "mine\0"  // 126
+    "vp\0"  // 127
+    "art\0"  // 128
+    "god\0"  // 129
+    "very\0"  // 130
+    "true\0"  // 131
+    "made\0"  // 132
+    "oh\0"  // 133
+    "lay\0"  // 134
+    "before\0"  // 135
+    "speake\0"  // 136
+    "hand\0"  // 137
+    "tell\0"  // 138
+    "though\0"  // 139
+    "t\0"  // 140
+    "life\0"  // 141
+    "into\0"  // 142
+    "doth\0"  // 143
+    "thinke\0"  // 144
+    "could\0"  // 145
+    "here\0"  // 146
+    "nor\0"  // 147
+    "gentle\0"  // 148
+    "have\0"  // 149
+    "away\0"  // 150
+    "cannot\0"  // 151
+    "neuer\0"  // 152
+    "thus\0"  // 153
+    "heauen\0"  // 154
+    "heart\0"  // 155
+    "looke\0"  // 156
+    "father\0"  // 157
+    "those\0"  // 158
+    "hast\0"  // 159
+    "better\0"  // 160
+    "faire\0"  // 161
+    "call\0"  // 162
+    "nothing\0"  // 163
+    "against\0"  // 164
+    "heare\0"  // 165
+    "name\0"  // 166
+    "world\0"  // 167
+    "dead\0"  // 168
+    "th\0"  // 169
+    "againe\0"  // 170
+    "about\0"  // 171
+    "been\0"  // 172
+    "comes\0"  // 173
+    "might\0"  // 174
+    "other\0"  // 175
+    "said\0"  // 176
+    "therefore\0"  // 177
+    "first\0"  // 178
+    "nay\0"  // 179
+    "eyes\0"  // 180
+    "matter\0"  // 181
+    "noble\0"  // 182
+    "blood\0"  // 183
+    "through\0"  // 184
+    "brother\0"  // 185
+    "hee\0"  // 186
+    "both\0"  // 187
+    "done\0"  // 188
+    "little\0"  // 189
+    "after\0"  // 190
+    "house\0"  // 191
+    "old\0"  // 192
+    "owne\0"  // 193
+    "pray\0"  // 194
+    "head\0"  // 195
+    "two\0"  // 196
+    "word\0"  // 197
+    "place\0"  // 198
+    "goe\0"  // 199
+    "soule\0"  // 200
+    "many\0"  // 201
+    "peace\0"  // 202
+    "upon\0"  // 203
+    "thing\0"  // 204
+    "duke\0"  // 205
+    "euen\0"  // 206
+    "young\0"  // 207
+    "feare\0"  // 208
+    "woman\0"  // 209
+    "sweet\0"  // 210
+    "put\0"  // 211
+    "grace\0"  // 212
+    "liue\0"  // 213
+    "off\0"  // 214
+    "lady\0"  // 215
+    "leaue\0"  // 216
+    "euer\0"  // 217
+    "till\0"  // 218
+    "whose\0"  // 219
+    "stand\0"  // 220
+    "once\0"  // 221
+    "downe\0"  // 222
+    "still\0"  // 223
+    "poore\0"  // 224
+    "set\0"  // 225
+    "way\0"  // 226
+    "long\0"  // 227
+    "without\0"  // 228
+    "face\0"  // 229
+    "came\0"  // 230
+    "thought\0"  // 231
+    "words\0"  // 232
+    "himself\0"  // 233
+    "caesar\0"  // 234
+    "comprehended\0"  // 235
+    "full\0"  // 236
+    "right\0"  // 237
+    "hold\0"  // 238
+    "fellow\0"  // 239
+    "beare\0"  // 240
+    "mother\0"  // 241
+    "tale\0"  // 242
+    "wife\0"  // 243
+    "dee\0"  // 244
+    "none\0"  // 245
+    "indeed\0"  // 246
+    "morrow\0"  // 247
+    "odorous\0"  // 248
+    "stay\0"  // 249
+    "ere\0"  // 250
+    "honest\0"  // 251
+    "terrible\0"  // 252
+    "room\0"  // 253
+    "sonne\0"  // 254
+    "whilst\0"  // 255
+    "rather\0"  // 256
+    "found\0"  // 257
+    "down\0"  // 258
+    "part\0"  // 259
+    "bring\0"  // 260
+    "friends\0"  // 261
+    "england\0"  // 262
+    "cause\0"  // 263
+    "france\0"  // 264
+    "than\0"  // 265
+    "own\0"  // 266
+    "keepe\0"  // 267
+    "play\0"  // 268
+    "gone\0"  // 269
+    "bed\0"  // 270
+    "heard\0"  // 271
+    "euery\0"  // 272
+    "aspicious\0"  // 273
+    "eye\0"  // 274
+    "friend\0"  // 275
+    "brutus\0"  // 276
+    "daughter\0"  // 277
+    "tongue\0"  // 278
+    "marry\0"  // 279
+    "purr\0"  // 280
+    "else\0"  // 281
+    "home\0"  // 282
+    "another\0"  // 283
+    "himselfe\0"  // 284
+    "within\0"  // 285
+    "law\0"  // 286
+    "fall\0"  // 287
+    "mee\0"  // 288
+    "rest\0"  // 289
+    "since\0"  // 290
+    "answer\0"  // 291
+    "always\0"  // 292
+    "truth\0"  // 293
+    "foole\0"  // 294
+    "mr\0"  // 295
+    "best\0"  // 296
+    "bid\0"  // 297
+    "prince\0"  // 298
+    "wee\0"  // 299
+    "nature\0"  // 300
+    "pardon\0"  // 301
+    "shalt\0"  // 302
+    "makes\0"  // 303
+    "light\0"  // 304
+    "things\0"  // 305
+    "watch\0"  // 306
+    "husband\0"  // 307
+    "each\0"  // 308
+    "finde\0"  // 309
+    "hands\0"  // 310
+    "thine\0"  // 311
+    "remember\0"  // 312
+    "same\0"  // 313
+    "earth\0"  // 314
+    "gentleman\0"  // 315
+    "high\0"  // 316
+    "forth\0"  // 317
+    "whom\0"  // 318
+    "shame\0"  // 319
+    "fortune\0"  // 320
+    "end\0"  // 321
+    "married\0"  // 322
+    "fox\0"  // 323
+    "up\0"  // 324
+    "madam\0"  // 325
+    "wilt\0"  // 326
+    "ill\0"  // 327
+    "youth\0"  // 328
+    "water\0"  // 329
+    "faith\0"  // 330
+    "romeo\0"  // 331
+    "kill\0"  // 332
+    "honor\0"  // 333
+    "reason\0"  // 334
+    "son\0"  // 335
+    "others\0"  // 336
+    "deere\0"  // 337
+    "letter\0"  // 338
+    "dost\0"  // 339
+    "respect\0"  // 340
+    "cassio\0"  // 341
+    "vnto\0"  // 342
+    "while\0"  // 343
+    "hope\0"  // 344
+    "shew\0"  // 345
+    "moral\0"  // 346
+    "false\0"  // 347
+    "please\0"  // 348
+    "attend\0"  // 349
+    "three\0"  // 350
+    "last\0"  // 351
+    "sent\0"  // 352
+    "alas\0"  // 353
+    "told\0"  // 354
+    "farewell\0"  // 355
+    "bee\0"  // 356
+    "saw\0"  // 357
+    "new\0"  // 358
+    "breath\0"  // 359
+    "hence\0"  // 360
+    "hither\0"  // 361
+    "mean\0"  // 362
+    "newes\0"  // 363
+    "l\0"  // 364
+    "get\0"  // 365
+    "senseless\0"  // 366
+    "tolerable\0"  // 367
+    "dye\0"  // 368
+    "state\0"  // 369
+    "alone\0"  // 370
+    "wrong\0"  // 371
+    "master\0"  // 372
+    "wish\0"  // 373
+    "follow\0"  // 374
+    "backe\0"  // 375
+    "boy\0"  // 376
+    "has\0"  // 377
+    "constable\0"  // 378
+    "never\0"  // 379
+    "power\0"  // 380
+    "ha\0"  // 381
+    "lost\0"  // 382
+    "present\0"  // 383
+    "yong\0"  // 384
+    "le\0"  // 385
+    "mary\0"  // 386
+    "tales\0"  // 387
+    "1\0"  // 388
+    "desire\0"  // 389
+    "fire\0"  // 390
+    "welcome\0"  // 391
+    "sword\0"  // 392
+    "enough\0"  // 393
+    "land\0"  // 394
+    "die\0"  // 395
+    "wit\0"  // 396
+    "show\0"  // 397
+    "body\0"  // 398
+    "either\0"  // 399
+    "fathers\0"  // 400
+    "together\0"  // 401
+    "purpose\0"  // 402
+    "shee\0"  // 403
+    "meane\0"  // 404
+    "beleeue\0"  // 405
+    "beene\0"  // 406
+    "helpe\0"  // 407
+    "teares\0"  // 408
+    "find\0"  // 409
+    "dogberry\0"  // 410
+    "send\0"  // 411
+    "write\0"  // 412
+    "meet\0"  // 413
+    "yours\0"  // 414
+    "lye\0"  // 415
+    "sleepe\0"  // 416
+    "letters\0"  // 417
+    "desartless\0"  // 418
+    "even\0"  // 419
+    "something\0"  // 420
+    "vse\0"  // 421
+    "left\0"  // 422
+    "sensible\0"  // 423
+    "loues\0"  // 424
+    "meanes\0"  // 425
+    "vnder\0"  // 426
+    "free\0"  // 427
+    "de\0"  // 428
+    "spirit\0"  // 429
+    "sure\0"  // 430
+    "watson\0"  // 431
+    "mad\0"  // 432
+    "houre\0"  // 433
+    "comfort\0"  // 434
+    "cut\0"  // 435
+    "truly\0"  // 436
+    "money\0"  // 437
+    "richard\0"  // 438
+    "beseech\0"  // 439
+    "queene\0"  // 440
+    "sigh\0"  // 441
+    "crow\0"  // 442
+    "villaine\0"  // 443
+    "re\0"  // 444
+    "intolerable\0"  // 445
+    "thyself\0"  // 446
+    "wil\0"  // 447
+    "ouer\0"  // 448
+    "brought\0"  // 449
+    "thousand\0"  // 450
+    "strong\0"  // 451
+    "care\0"  // 452
+    "sight\0"  // 453
+    "need\0"  // 454
+    "enter\0"  // 455
+    "sweare\0"  // 456
+    "sound\0"  // 457
+    "holy\0"  // 458
+    "foule\0"  // 459
+    "gods\0"  // 460
+    "hearts\0"  // 461
+    "age\0"  // 462
+    "morning\0"  // 463
+    "2\0"  // 464
+    "seene\0"  // 465
+    "dress\0"  // 466
+    "armes\0"  // 467
+    "thoughts\0"  // 468
+    "doubt\0"  // 469
+    "hell\0"  // 470
+    "turne\0"  // 471
+    "french\0"  // 472
+    "crowne\0"  // 473
+    "mark\0"  // 474
+    "side\0"  // 475
+    "prosper\0"  // 476
+    "strange\0"  // 477
+    "thanke\0"  // 478
+    "warre\0"  // 479
+    "person\0"  // 480
+    "kings\0"  // 481
+    "bloody\0"  // 482
+    "excellent\0"  // 483
+    "sons\0"  // 484
+    "soules\0"  // 485
+    "because\0"  // 486
+    "sister\0"  // 487
+    "royall\0"  // 488
+    "liues\0"  // 489
+    "times\0"  // 490
+    "borne\0"  // 491
+    "sit\0"  // 492
+    "eare\0"  // 493
+    "horse\0"  // 494
+    "mercy\0"  // 495
+    "carefully\0"  // 496
+    "hamlet\0"  // 497
+    "charge\0"  // 498
+    "graue\0"  // 499
+    "marke\0"  // 500
+    "kind\0"  // 501
+    "dance\0"  // 502
+    "marriage\0"  // 503
+    "only\0"  // 504
+    "proue\0"  // 505
+    "gracious\0"  // 506
+    "mouth\0"  // 507
+    "kinde\0"  // 508
+    "worke\0"  // 509
+    "cassius\0"  // 510
+    "angelo\0"  // 511
+    "onely\0"  // 512
+    "its\0"  // 513
+    "brothers\0"  // 514
+    "lords\0"  // 515
+    "change\0"  // 516
+    "common\0"  // 517
+    "cold\0"  // 518
+    "voice\0"  // 519
+    "saue\0"  // 520
+    "hate\0"  // 521
+    "fault\0"  // 522
+    "look\0"  // 523
+    "past\0"  // 524
+    "deare\0"  // 525
+    "neere\0"  // 526
+    "english\0"  // 527
+    "seeke\0"  // 528
+    "sake\0"  // 529
+    "hang\0"  // 530
+    "minde\0"  // 531
+    "sorrow\0"  // 532
+    "warrant\0"  // 533
+    "breake\0"  // 534
+    "ore\0"  // 535
+    "bad\0"  // 536
+    "lookes\0"  // 537
+    "ground\0"  // 538
+    "small\0"  // 539
+    "whether\0"  // 540
+    "masters\0"  // 541
+    "content\0"  // 542
+    "give\0"  // 543
+    "justice\0"  // 544
+    "avoid\0"  // 545
+    "dees\0"  // 546
+    "farre\0"  // 547
+    "ioy\0"  // 548
+    "innocent\0"  // 549
+    "dinner\0"  // 550
+    "praise\0"  // 551
+    "sad\0"  // 552
+    "bin\0"  // 553
+    "sea\0"  // 554
+    "alice\0"  // 555
+    "want\0"  // 556
+    "white\0"  // 557
+    "late\0"  // 558
+    "least\0"  // 559
+    "speak\0"  // 560
+    "next\0"  // 561
+    "speech\0"  // 562
+    "attention\0"  // 563
+    "knew\0"  // 564
+    "betweene\0"  // 565
+    "draw\0"  // 566
+    "act\0"  // 567
+    "benefactor\0"  // 568
+    "malefactor\0"  // 569
+    "covered\0"  // 570
+    "every\0"  // 571
+    "turner\0"  // 572
+    "lies\0"  // 573
+    "fell\0"  // 574
+    "people\0"  // 575
+    "taste\0"  // 576
+    "arthur\0"  // 577
+    "dis\0"  // 578
+    "axe\0"  // 579
+    "goose\0"  // 580
+    "patience\0"  // 581
+    "open\0"  // 582
+    "behold\0"  // 583
+    "gentlemen\0"  // 584
+    "spoke\0"  // 585
+    "vertue\0"  // 586
+    "mind\0"  // 587
+    "think\0"  // 588
+    "office\0"  // 589
+    "lion\0"  // 590
+    "antony\0"  // 591
+    "pale\0"  // 592
+    "twas\0"  // 593
+    "cry\0"  // 594
+    "often\0"  // 595
+    "met\0"  // 596
+    "fit\0"  // 597
+    "making\0"  // 598
+    "liege\0"  // 599
+    "offer\0"  // 600
+    "us\0"  // 601
+    "iohn\0"  // 602
+    "happy\0"  // 603
+    "yes\0"  // 604
+    "y\0"  // 605
+    "returne\0"  // 606
+    "maiestie\0"  // 607
+    "worst\0"  // 608
+    "manners\0"  // 609
+    "question\0"  // 610
+    "does\0"  // 611
+    "again\0"  // 612
+    "immediately\0"  // 613
+    "street\0"  // 614
+    "iago\0"  // 615
+    "herself\0"  // 616
+    "careful\0"  // 617
+    "ity\0"  // 618
+    "clair\0"  // 619
+    "hatherley\0"  // 620
+    "dayes\0"  // 621
+    "women\0"  // 622
+    "creature\0"  // 623
+    "seruice\0"  // 624
+    "red\0"  // 625
+    "matters\0"  // 626
+    "mistris\0"  // 627
+    "knowes\0"  // 628
+    "duty\0"  // 629
+    "second\0"  // 630
+    "read\0"  // 631
+    "named\0"  // 632
+    "become\0"  // 633
+    "diuell\0"  // 634
+    "arme\0"  // 635
+    "proud\0"  // 636
+    "children\0"  // 637
+    "fight\0"  // 638
+    "dreame\0"  // 639
+    "kisse\0"  // 640
+    "moone\0"  // 641
+    "generall\0"  // 642
+    "pleasure\0"  // 643
+    "went\0"  // 644
+    "church\0"  // 645
+    "learn\0"  // 646
+    "weare\0"  // 647
+    "run\0"  // 648
+    "weepe\0"  // 649
+    "selues\0"  // 650
+    "command\0"  // 651
+    "order\0"  // 652
+    "woe\0"  // 653
+    "hard\0"  // 654
+    "note\0"  // 655
+    "john\0"  // 656
+    "ettycate\0"  // 657
+    "business\0"  // 658
+    "miss\0"  // 659
+    "giuen\0"  // 660
+    "wise\0"  // 661
+    "secret\0"  // 662
+    "teach\0"  // 663
+    "already\0"  // 664
+    "company\0"  // 665
+    "meete\0"  // 666
+    "seen\0"  // 667
+    "sing\0"  // 668
+    "pay\0"  // 669
+    "further\0"  // 670
+    "bosome\0"  // 671
+    "forget\0"  // 672
+    "thinking\0"  // 673
+    "almost\0"  // 674
+    "talke\0"  // 675
+    "course\0"  // 676
+    "rude\0"  // 677
+    "rich\0"  // 678
+    "claudio\0"  // 679
+    "moore\0"  // 680
+    "bound\0"  // 681
+    "ladies\0"  // 682
+    "presence\0"  // 683
+    "lesse\0"  // 684
+    "grow\0"  // 685
+    "maid\0"  // 686
+    "malefactors\0"  // 687
+    "iust\0"  // 688
+    "worship\0"  // 689
+    "return\0"  // 690
+    "kept\0"  // 691
+    "scena\0"  // 692
+    "blacke\0"  // 693
+    "touch\0"  // 694
+    "point\0"  // 695
+    "rage\0"  // 696
+    "worse\0"  // 697
+    "foolish\0"  // 698
+    "seeme\0"  // 699
+    "mans\0"  // 700
+    "reputation\0"  // 701
+    "offence\0"  // 702
+    "called\0"  // 703
+    "comprehend\0"  // 704
+    "halfe\0"  // 705
+    "sayes\0"  // 706
+    "childe\0"  // 707
+    "ah\0"  // 708
+    "field\0"  // 709
+    "guilty\0"  // 710
+    "goes\0"  // 711
+    "whole\0"  // 712
+    "deepe\0"  // 713
+    "conduct\0"  // 714
+    "presently\0"  // 715
+    "oft\0"  // 716
+    "didst\0"  // 717
+    "sun\0"  // 718
+    "writ\0"  // 719
+    "during\0"  // 720
+    "london\0"  // 721
+    "lou\0"  // 722
+    "case\0"  // 723
+    "murder\0"  // 724
+    "coronet\0"  // 725
+    "hunter\0"  // 726
+    "ayre\0"  // 727
+    "murther\0"  // 728
+    "hot\0"  // 729
+    "cast\0"  // 730
+    "businesse\0"  // 731
+    "gold\0"  // 732
+    "prison\0"  // 733
+    "confesse\0"  // 734
+    "learned\0"  // 735
+    "holder\0"  // 736
+    "yorke\0"  // 737
+    "neither\0"  // 738
+    "golden\0"  // 739
+    "trust\0"  // 740
+    "due\0"  // 741
+    "themselues\0"  // 742
+    "opinion\0"  // 743
+    "promise\0"  // 744
+    "bore\0"  // 745
+    "oath\0"  // 746
+    "sicke\0"  // 747
+    "gaue\0"  // 748
+    "force\0"  // 749
+    "knight\0"  // 750
+    "verie\0"  // 751
+    "particular\0"  // 752
+    "character\0"  // 753
+    "myself\0"  // 754
+    "use\0"  // 755
+    "deception\0"  // 756
+    "remarkable\0"  // 757
+    "mccarthy\0"  // 758
+    "james\0"  // 759
+    "yea\0"  // 760
+    "withall\0"  // 761
+    "reuenge\0"  // 762
+    "along\0"  // 763
+    "hauing\0"  // 764
+    "eares\0"  // 765
+    "smile\0"  // 766
+    "dog\0"  // 767
+    "suffer\0"  // 768
+    "thinkes\0"  // 769
+    "turn\0"  // 770
+    "table\0"  // 771
+    "vnckle\0"  // 772
+    "cousin\0"  // 773
+    "forme\0"  // 774
+    "perhaps\0"  // 775
+    "sometimes\0"  // 776
+    "honour\0"  // 777
+    "rome\0"  // 778
+    "mouse\0"  // 779
+    "maiesty\0"  // 780
+    "edward\0"  // 781
+    "excuse\0"  // 782
+    "worthy\0"  // 783
+    "slaine\0"  // 784
+    "beauty\0"  // 785
+    "hide\0"  // 786
+    "conscience\0"  // 787
+    "heauens\0"  // 788
+    "worth\0"  // 789
+    "ho\0"  // 790
+    "nurse\0"  // 791
+    "fast\0"  // 792
+    "besides\0"  // 793
+    "glad\0"  // 794
+    "fled\0"  // 795
+    "fear\0"  // 796
+    "captaine\0"  // 797
+    "breeding\0"  // 798
+    "concerning\0"  // 799
+    "knaue\0"  // 800
+    "canst\0"  // 801
+    "quite\0"  // 802
+    "drinke\0"  // 803
+    "manner\0"  // 804
+    "loose\0"  // 805
+    "window\0"  // 806
+    "wall\0"  // 807
+    "passion\0"  // 808
+    "hear\0"  // 809
+    "keep\0"  // 810
+    "sport\0"  // 811
+    "musicke\0"  // 812
+    "visits\0"  // 813
+    "dangerous\0"  // 814
+    "count\0"  // 815
+    "ought\0"  // 816
+    "ye\0"  // 817
+    "valiant\0"  // 818
+    "quiet\0"  // 819
+    "soft\0"  // 820
+    "straight\0"  // 821
+    "prepare\0"  // 822
+    "precious\0"  // 823
+    "iustice\0"  // 824
+    "consent\0"  // 825
+    "eat\0"  // 826
+    "fortunes\0"  // 827
+    "dancing\0"  // 828
+    "serve\0"  // 829
+    "comprehensible\0"  // 830
+    "mortification\0"  // 831
+    "completely\0"  // 832
+    "criminal\0"  // 833
+    "wilson\0"  // 834
+    "rucastle\0"  // 835
+    "strike\0"  // 836
+    "soueraigne\0"  // 837
+    "winde\0"  // 838
+    "begin\0"  // 839
+    "fetch\0"  // 840
+    "sort\0"  // 841
+    "tender\0"  // 842
+    "short\0"  // 843
+    "aske\0"  // 844
+    "back\0"  // 845
+    "base\0"  // 846
+    "greefe\0"  // 847
+    "towne\0"  // 848
+    "hundred\0"  // 849
+    "hoa\0"  // 850
+    "also\0"  // 851
+    "modest\0"  // 852
+    "yeares\0"  // 853
+    "curse\0"  // 854
+    "marrie\0"  // 855
+    "mercury\0"  // 856
+    "pride\0"  // 857
+    "wedding\0"  // 858
+    "step\0"  // 859
+    "wind\0"  // 860
+    "iuliet\0"  // 861
+    "sunne\0"  // 862
+    "dare\0"  // 863
+    "league\0"  // 864
+    "certaine\0"  // 865
+    "perfect\0"  // 866
+    "seeing\0"  // 867
+    "ancient\0"  // 868
+    "haste\0"  // 869
+    "strength\0"  // 870
+    "died\0"  // 871
+    "cried\0"  // 872
+    "boiling\0"  // 873
+    "appear\0"  // 874
+    "returned\0"  // 875
+    "clarence\0"  // 876
+    "enemies\0"  // 877
+    "poyson\0"  // 878
+    "comming\0"  // 879
+    "ready\0"  // 880
+    "began\0"  // 881
+    "princes\0"  // 882
+    "sweete\0"  // 883
+    "giues\0"  // 884
+    "visit\0"  // 885
+    "stands\0"  // 886
+    "march\0"  // 887
+    "sin\0"  // 888
+    "measure\0"  // 889
+    "having\0"  // 890
+    "asked\0"  // 891
+    "just\0"  // 892
+    "wolf\0"  // 893
+    "wisdom\0"  // 894
+    "recall\0"  // 895
+    "agreeable\0"  // 896
+    "ant\0"  // 897
+    "roylott\0"  // 898
+    "chamber\0"  // 899
+    "vnlesse\0"  // 900
+    "foot\0"  // 901
+    "deliuer\0"  // 902
+    "knowne\0"  // 903
+    "deed\0"  // 904
+    "means\0"  // 905
+    "wherefore\0"  // 906
+    "heads\0"  // 907
+    "committed\0"  // 908
+    "boone\0"  // 909
+    "tooke\0"  // 910
+    "fare\0"  // 911
+    "sense\0"  // 912
+    "written\0"  // 913
+    "ball\0"  // 914
+    "lamb\0"  // 915
+    "frier\0"  // 916
+    "helen\0"  // 917
+    "officer\0"  // 918
+    "benefactors\0"  // 919
+    "merry\0"  // 920
+    "court\0"  // 921
+    "passe\0"  // 922
+    "taken\0"  // 923
+    "ring\0"  // 924
+    "soone\0"  // 925
+    "speakes\0"  // 926
+    "walke\0"  // 927
+    "houres\0"  // 928
+    "wherein\0"  // 929
+    "occasion\0"  // 930
+    "troth\0"  // 931
+    "louing\0"  // 932
+    "seemes\0"  // 933
+    "third\0"  // 934
+    "knowing\0"  // 935
+    "seem\0"  // 936
+    "lysander\0"  // 937
+    "summer\0"  // 938
+    "highnesse\0"  // 939
+    "fauour\0"  // 940
+    "mortall\0"  // 941
+    "liuing\0"  // 942
+    "braue\0"  // 943
+    "buckingham\0"  // 944
+    "griefe\0"  // 945
+    "serue\0"  // 946
+    "lips\0"  // 947
+    "heauy\0"  // 948
+    "defend\0"  // 949
+    "few\0"  // 950
+    "greene\0"  // 951
+    "souldier\0"  // 952
+    "voyce\0"  // 953
+    "lie\0"  // 954
+    "bullingbrooke\0"  // 955
+    "simon\0"  // 956
+    "woodman\0"  // 957
+    "simple\0"  // 958
+    "stop\0"  // 959
+    "eate\0"  // 960
+    "report\0"  // 961
+    "disposition\0"  // 962
+    "shake\0"  // 963
+    "sinne\0"  // 964
+    "fooles\0"  // 965
+    "work\0"  // 966
+    "foure\0"  // 967
+    "lead\0"  // 968
+    "ease\0"  // 969
+    "appeare\0"  // 970
+    "louers\0"  // 971
+    "demetrius\0"  // 972
+    "vagrom\0"  // 973
+    "used\0"  // 974
+    "leave\0"  // 975
+    "stork\0"  // 976
+    "received\0"  // 977
+    "frogs\0"  // 978
+    "evening\0"  // 979
+    "lived\0"  // 980
+    "photograph\0"  // 981
+    "walking\0"  // 982
+    "beast\0"  // 983
+    "health\0"  // 984
+    "action\0"  // 985
+    "moue\0"  // 986
+    "broken\0"  // 987
+    "throw\0"  // 988
+    "cunning\0"  // 989
+    "bold\0"  // 990
+    "wonder\0"  // 991
+    "shal\0"  // 992
+    "iron\0"  // 993
+    "wits\0"  // 994
+    "tybalt\0"  // 995
+    "fate\0"  // 996
+    "angel\0"  // 997
+    "position\0"  // 998
+    "relate\0"  // 999
+    "learne\0"  // 1000
+    "mighty\0"  // 1001
+    "study\0"  // 1002
+    "mens\0"  // 1003
+    "honesty\0"  // 1004
+    "paines\0"  // 1005
+    "mothers\0"  // 1006
+    "awake\0"  // 1007
+    "sleeping\0"  // 1008
+    "going\0"  // 1009
+    "far\0"  // 1010
+    "anon\0"  // 1011
+    "flye\0"  // 1012
+    "offend\0"  // 1013
+    "willing\0"  // 1014
+    "poor\0"  // 1015
+    "madnesse\0"  // 1016
+    "fashion\0"  // 1017
+    "fine\0"  // 1018
+    "bird\0"  // 1019
+    "memory\0"  // 1020
+    "winter\0"  // 1021
+    "safe\0"  // 1022
+    "pitty\0"  // 1023
+    "close\0"  // 1024
+    "patient\0"  // 1025
+    "scorne\0"  // 1026
+    "held\0"  // 1027
+    "longer\0"  // 1028
+    "twere\0"  // 1029
+    "knowledge\0"  // 1030
+    "meant\0"  // 1031
+    "needs\0"  // 1032
+    "punishment\0"  // 1033
+    "danger\0"  // 1034
+    "spirits\0"  // 1035
+    "double\0"  // 1036
+    "shouldst\0"  // 1037
+    "beard\0"  // 1038
+    "answere\0"  // 1039
+    "according\0"  // 1040
+    "beggar\0"  // 1041
+    "violently\0"  // 1042
+    "hermia\0"  // 1043
+    "charles\0"  // 1044
+    "family\0"  // 1045
+    "air\0"  // 1046
+    "caesars\0"  // 1047
+    "known\0"  // 1048
+    "hastings\0"  // 1049
+    "ne\0"  // 1050
+    "honourable\0"  // 1051
+    "laid\0"  // 1052
+    "quarrell\0"  // 1053
+    "proper\0"  // 1054
+    "harme\0"  // 1055
+    "losse\0"  // 1056
+    "vile\0"  // 1057
+    "m\0"  // 1058
+    "indeede\0"  // 1059
+    "warres\0"  // 1060
+    "season\0"  // 1061
+    "iudgement\0"  // 1062
+    "depart\0"  // 1063
+    "sworne\0"  // 1064
+    "broke\0"  // 1065
+    "blessed\0"  // 1066
+    "fie\0"  // 1067
+    "early\0"  // 1068
+    "child\0"  // 1069
+    "circumstances\0"  // 1070
+    "parts\0"  // 1071
+    "party\0"  // 1072
+    "hearing\0"  // 1073
+    "possible\0"  // 1074
+    "able\0"  // 1075
+    "writing\0"  // 1076
+    "desdemona\0"  // 1077
+    "othello\0"  // 1078
+    "ever\0"  // 1079
+    "reader\0"  // 1080
+    "living\0"  // 1081
+    "happened\0"  // 1082
+    "villainy\0"  // 1083
+    "clever\0"  // 1084
+    "hair\0"  // 1085
+    "press\0"  // 1086
+    "uncle\0"  // 1087
+    "adventure\0"  // 1088
+    "ryder\0"  // 1089
+    "dr\0"  // 1090
+    "hatty\0"  // 1091
+    "burnwell\0"  // 1092
+    "weake\0"  // 1093
+    "thankes\0"  // 1094
+    "lyes\0"  // 1095
+    "deeds\0"  // 1096
+    "slaue\0"  // 1097
+    "weeping\0"  // 1098
+    "yeeld\0"  // 1099
+    "toward\0"  // 1100
+    "noise\0"  // 1101
+    "low\0"  // 1102
+    "wine\0"  // 1103
+    "shape\0"  // 1104
+    "dutie\0"  // 1105
+    "subiect\0"  // 1106
+    "birth\0"  // 1107
+    "lieutenant\0"  // 1108
+    "harry\0"  // 1109
+    "country\0"  // 1110
+    "horses\0"  // 1111
+    "bloud\0"  // 1112
+    "certain\0"  // 1113
+    "bride\0"  // 1114
+    "hurt\0"  // 1115
+    "villain\0"  // 1116
+    "hugh\0"  // 1117
+    "piramus\0"  // 1118
+    "hat\0"  // 1119
+    "toby\0"  // 1120
+    "humbly\0"  // 1121
+    "reach\0"  // 1122
+    "effect\0"  // 1123
+    "black\0"  // 1124
+    "dull\0"  // 1125
+    "iudge\0"  // 1126
+    "beware\0"  // 1127
+    "mock\0"  // 1128
+    "bones\0"  // 1129
+    "remembrance\0"  // 1130
+    "vice\0"  // 1131
+    "beares\0"  // 1132
+    "story\0"  // 1133
+    "rule\0"  // 1134
+    "win\0"  // 1135
+    "fiue\0"  // 1136
+    "easily\0"  // 1137
+    "adieu\0"  // 1138
+    "dust\0"  // 1139
+    "flesh\0"  // 1140
+    "asse\0"  // 1141
+    "host\0"  // 1142
+    "song\0"  // 1143
+    "tried\0"  // 1144
+    "parties\0"  // 1145
+    "rosalind\0"  // 1146
+    "louer\0"  // 1147
+    "idle\0"  // 1148
+    "deny\0"  // 1149
+    "aside\0"  // 1150
+    "wicked\0"  // 1151
+    "enemy\0"  // 1152
+    "contempt\0"  // 1153
+    "suite\0"  // 1154
+    "bitter\0"  // 1155
+    "kingdome\0"  // 1156
+    "paper\0"  // 1157
+    "silence\0"  // 1158
+    "tree\0"  // 1159
+    "dying\0"  // 1160
+    "vnderstand\0"  // 1161
+    "fore\0"  // 1162
+    "naturally\0"  // 1163
+    "sacred\0"  // 1164
+    "banish\0"  // 1165
+    "hubert\0"  // 1166
+    "food\0"  // 1167
+    "escape\0"  // 1168
+    "years\0"  // 1169
+    "maluolio\0"  // 1170
+    "showing\0"  // 1171
+    "instruction\0"  // 1172
+    "degree\0"  // 1173
+    "treason\0"  // 1174
+    "secunda\0"  // 1175
+    "rules\0"  // 1176
+    "amen\0"  // 1177
+    "wert\0"  // 1178
+    "fearefull\0"  // 1179
+    "buy\0"  // 1180
+    "among\0"  // 1181
+    "wash\0"  // 1182
+    "wiues\0"  // 1183
+    "prethee\0"  // 1184
+    "neighbour\0"  // 1185
+    "3\0"  // 1186
+    "speed\0"  // 1187
+    "proofe\0"  // 1188
+    "booke\0"  // 1189
+    "moment\0"  // 1190
+    "pure\0"  // 1191
+    "bearing\0"  // 1192
+    "dolphin\0"  // 1193
+    "surely\0"  // 1194
+    "carry\0"  // 1195
+    "fingers\0"  // 1196
+    "fresh\0"  // 1197
+    "apt\0"  // 1198
+    "arm\0"  // 1199
+    "wood\0"  // 1200
+    "assure\0"  // 1201
+    "folly\0"  // 1202
+    "kate\0"  // 1203
+    "door\0"  // 1204
+    "under\0"  // 1205
+    "save\0"  // 1206
+    "given\0"  // 1207
+    "river\0"  // 1208
+    "ants\0"  // 1209
+    "over\0"  // 1210
+    "jupiter\0"  // 1211
+    "accuracy\0"  // 1212
+    "observation\0"  // 1213
+    "conversation\0"  // 1214
+    "vulgarity\0"  // 1215
+    "days\0"  // 1216
+    "windibank\0"  // 1217
+    "moulton\0"  // 1218
+    "tower\0"  // 1219
+    "crosse\0"  // 1220
+    "foote\0"  // 1221
+    "crimes\0"  // 1222
+    "reasons\0"  // 1223
+    "richmond\0"  // 1224
+    "desires\0"  // 1225
+    "shewes\0"  // 1226
+    "match\0"  // 1227
+    "condition\0"  // 1228
+    "wel\0"  // 1229
+    "lose\0"  // 1230
+    "drop\0"  // 1231
+    "tedious\0"  // 1232
+    "coward\0"  // 1233
+    "keepes\0"  // 1234
+    "offended\0"  // 1235
+    "colour\0"  // 1236
+    "paris\0"  // 1237
+    "kinsman\0"  // 1238
+    "mistresse\0"  // 1239
+    "aboue\0"  // 1240
+    "thrice\0"  // 1241
+    "behind\0"  // 1242
+    "ten\0"  // 1243
+    "lacke\0"  // 1244
+    "courage\0"  // 1245
+    "wishes\0"  // 1246
+    "clay\0"  // 1247
+    "guests\0"  // 1248
+    "nose\0"  // 1249
+    "snake\0"  // 1250
+    "pompey\0"  // 1251
+    "appearance\0"  // 1252
+    "entertainment\0"  // 1253
+    "horatio\0"  // 1254
+    "laertes\0"  // 1255
+    "edwards\0"  // 1256
+    "vertuous\0"  // 1257
+    "plaine\0"  // 1258
+    "liberty\0"  // 1259
+    "wretched\0"  // 1260
+    "dogge\0"  // 1261
+    "blame\0"  // 1262
+    "fill\0"  // 1263
+    "doing\0"  // 1264
+    "dispatch\0"  // 1265
+    "ripe\0"  // 1266
+    "heauie\0"  // 1267
+    "names\0"  // 1268
+    "counsell\0"  // 1269
+    "stirre\0"  // 1270
+    "stones\0"  // 1271
+    "darke\0"  // 1272
+    "prythee\0"  // 1273
+    "bred\0"  // 1274
+    "purse\0"  // 1275
+    "holds\0"  // 1276
+    "gallant\0"  // 1277
+    "faults\0"  // 1278
+    "feeling\0"  // 1279
+    "begging\0"  // 1280
+    "rise\0"  // 1281
+    "saying\0"  // 1282
+    "greater\0"  // 1283
+    "commend\0"  // 1284
+    "laugh\0"  // 1285
+    "prisoner\0"  // 1286
+    "vaine\0"  // 1287
+    "forrest\0"  // 1288
+    "followed\0"  // 1289
+    "quickly\0"  // 1290
+    "coat\0"  // 1291
+    "reade\0"  // 1292
+    "innocence\0"  // 1293
+    "band\0"  // 1294
+    "language\0"  // 1295
+    "headed\0"  // 1296
+    "villains\0"  // 1297
+    "thumb\0"  // 1298
+    "negligence\0"  // 1299
+    "rodorigo\0"  // 1300
+    "partner\0"  // 1301
+    "pretty\0"  // 1302
+    "passing\0"  // 1303
+    "saint\0"  // 1304
+    "quicke\0"  // 1305
+    "teare\0"  // 1306
+    "crown\0"  // 1307
+    "wast\0"  // 1308
+    "vain\0"  // 1309
+    "steale\0"  // 1310
+    "chance\0"  // 1311
+    "dukes\0"  // 1312
+    "title\0"  // 1313
+    "blesse\0"  // 1314
+    "valour\0"  // 1315
+    "seat\0"  // 1316
+    "aduantage\0"  // 1317
+    "brow\0"  // 1318
+    "pittie\0"  // 1319
+    "stone\0"  // 1320
+    "tent\0"  // 1321
+    "tane\0"  // 1322
+    "ride\0"  // 1323
+    "seeking\0"  // 1324
+    "rose\0"  // 1325
+    "approach\0"  // 1326
+    "examined\0"  // 1327
+    "demands\0"  // 1328
+    "feathers\0"  // 1329
+    "cruell\0"  // 1330
+    "confidence\0"  // 1331
+    "guest\0"  // 1332
+    "eating\0"  // 1333
+    "signior\0"  // 1334
+    "forms\0"  // 1335
+    "ie\0"  // 1336
+    "perfectly\0"  // 1337
+    "crime\0"  // 1338
+    "issue\0"  // 1339
+    "wretch\0"  // 1340
+    "wide\0"  // 1341
+    "fierce\0"  // 1342
+    "angry\0"  // 1343
+    "damned\0"  // 1344
+    "lend\0"  // 1345
+    "witnesse\0"  // 1346
+    "forgot\0"  // 1347
+    "naturall\0"  // 1348
+    "repent\0"  // 1349
+    "christian\0"  // 1350
+    "vow\0"  // 1351
+    "intelligence\0"  // 1352
+    "quoth\0"  // 1353
+    "perceiue\0"  // 1354
+    "clocke\0"  // 1355
+    "rough\0"  // 1356
+    "briefe\0"  // 1357
+    "souldiers\0"  // 1358
+    "satisfied\0"  // 1359
+    "sence\0"  // 1360
+    "companie\0"  // 1361
+    "agreed\0"  // 1362
+    "drinking\0"  // 1363
+    "dish\0"  // 1364
+    "learning\0"  // 1365
+    "error\0"  // 1366
+    "caska\0"  // 1367
+    "caes\0"  // 1368
+    "sen\0"  // 1369
+    "steal\0"  // 1370
+    "proved\0"  // 1371
+    "eventually\0"  // 1372
+    "served\0"  // 1373
+    "year\0"  // 1374
+    "pitcher\0"  // 1375
+    "graceful\0"  // 1376
+    "suspicious\0"  // 1377
+    "details\0"  // 1378
+    "love\0"  // 1379
+    "several\0"  // 1380
+    "police\0"  // 1381
+    "mysterious\0"  // 1382
+    "klan\0"  // 1383
+    "christmas\0"  // 1384
+    "julia\0"  // 1385
+    "guard\0"  // 1386
+    "naked\0"  // 1387
+    "beg\0"  // 1388
+    "euerie\0"  // 1389
+    "bow\0"  // 1390
+    "subiects\0"  // 1391
+    "bright\0"  // 1392
+    "yonder\0"  // 1393
+    "terror\0"  // 1394
+    "faine\0"  // 1395
+    "scene\0"  // 1396
+    "swift\0"  // 1397
+    "estate\0"  // 1398
+    "account\0"  // 1399
+    "fond\0"  // 1400
+    "beautie\0"  // 1401
+    "madame\0"  // 1402
+    "round\0"  // 1403
+    "swords\0"  // 1404
+    "motion\0"  // 1405
+    "vncle\0"  // 1406
+    "natiue\0"  // 1407
+    "waste\0"  // 1408
+    "doore\0"  // 1409
+    "streets\0"  // 1410
+    "ship\0"  // 1411
+    "pleasant\0"  // 1412
+    "sat\0"  // 1413
+    "odious\0"  // 1414
+    "suitor\0"  // 1415
+    "handkerchiefe\0"  // 1416
+    "looking\0"  // 1417
+    "whiles\0"  // 1418
+    "endure\0"  // 1419
+    "aliue\0"  // 1420
+    "stood\0"  // 1421
+    "tertia\0"  // 1422
+    "banished\0"  // 1423
+    "catch\0"  // 1424
+    "princely\0"  // 1425
+    "catesby\0"  // 1426
+    "tongues\0"  // 1427
+    "feele\0"  // 1428
+    "receiue\0"  // 1429
+    "sonnes\0"  // 1430
+    "cosin\0"  // 1431
+    "norfolke\0"  // 1432
+    "cheeke\0"  // 1433
+    "thank\0"  // 1434
+    "spring\0"  // 1435
+    "nights\0"  // 1436
+    "doctor\0"  // 1437
+    "number\0"  // 1438
+    "teeth\0"  // 1439
+    "mocke\0"  // 1440
+    "greatest\0"  // 1441
+    "saies\0"  // 1442
+    "purposes\0"  // 1443
+    "sirrah\0"  // 1444
+    "ladie\0"  // 1445
+    "truely\0"  // 1446
+    "feast\0"  // 1447
+    "argument\0"  // 1448
+    "acquaintance\0"  // 1449
+    "allow\0"  // 1450
+    "c\0"  // 1451
+    "sufficient\0"  // 1452
+    "remain\0"  // 1453
+    "orlando\0"  // 1454
+    "took\0"  // 1455
+    "clouds\0"  // 1456
+    "alacke\0"  // 1457
+    "lordship\0"  // 1458
+    "slaughter\0"  // 1459
+    "throat\0"  // 1460
+    "grant\0"  // 1461
+    "englands\0"  // 1462
+    "battaile\0"  // 1463
+    "happie\0"  // 1464
+    "haire\0"  // 1465
+    "daies\0"  // 1466
+    "wisedome\0"  // 1467
+    "behinde\0"  // 1468
+    "knees\0"  // 1469
+    "nere\0"  // 1470
+    "desperate\0"  // 1471
+    "talk\0"  // 1472
+    "appeared\0"  // 1473
+    "request\0"  // 1474
+    "starres\0"  // 1475
+    "yeeres\0"  // 1476
+    "drunke\0"  // 1477
+    "hungry\0"  // 1478
+    "acquainted\0"  // 1479
+    "creatures\0"  // 1480
+    "large\0"  // 1481
+    "half\0"  // 1482
+    "pleased\0"  // 1483
+    "contemptuous\0"  // 1484
+    "lippes\0"  // 1485
+    "instruct\0"  // 1486
+    "pocket\0"  // 1487
+    "wouldst\0"  // 1488
+    "thrust\0"  // 1489
+    "between\0"  // 1490
+    "bank\0"  // 1491
+    "cards\0"  // 1492
+    "vanity\0"  // 1493
+    "trade\0"  // 1494
+    "flowers\0"  // 1495
+    "following\0"  // 1496
+    "vous\0"  // 1497
+    "entire\0"  // 1498
+    "mortified\0"  // 1499
+    "dreadfull\0"  // 1500
+    "vn\0"  // 1501
+    "euill\0"  // 1502
+    "towards\0"  // 1503
+    "empty\0"  // 1504
+    "thither\0"  // 1505
+    "twenty\0"  // 1506
+    "knee\0"  // 1507
+    "speaks\0"  // 1508
+    "plague\0"  // 1509
+    "therein\0"  // 1510
+    "grosse\0"  // 1511
+    "spent\0"  // 1512
+    "glory\0"  // 1513
+    "length\0"  // 1514
+    "wombe\0"  // 1515
+    "damn\0"  // 1516
+    "snow\0"  // 1517
+    "labour\0"  // 1518
+    "enemie\0"  // 1519
+    "throne\0"  // 1520
+    "hart\0"  // 1521
+    "wound\0"  // 1522
+    "iest\0"  // 1523
+    "taking\0"  // 1524
+    "forward\0"  // 1525
+    "discourse\0"  // 1526
+    "neece\0"  // 1527
+    "growes\0"  // 1528
+    "traitors\0"  // 1529
+    "tyrant\0"  // 1530
+    "wrongs\0"  // 1531
+    "seuen\0"  // 1532
+    "vowes\0"  // 1533
+    "eies\0"  // 1534
+    "gates\0"  // 1535
+    "gainst\0"  // 1536
+    "siluer\0"  // 1537
+    "merit\0"  // 1538
+    "natures\0"  // 1539
+    "demand\0"  // 1540
+    "takes\0"  // 1541
+    "bell\0"  // 1542
+    "beasts\0"  // 1543
+    "city\0"  // 1544
+    "helena\0"  // 1545
+    "seeming\0"  // 1546
+    "gate\0"  // 1547
+    "shop\0"  // 1548
+    "grapes\0"  // 1549
+    "disguise\0"  // 1550
+    "ceremony\0"  // 1551
+    "shepheard\0"  // 1552
+    "prouost\0"  // 1553
+    "virtue\0"  // 1554
+    "fellows\0"  // 1555
+    "ass\0"  // 1556
+    "remembered\0"  // 1557
+    "considerable\0"  // 1558
+    "vigilant\0"  // 1559
+    "understanding\0"  // 1560
+    "using\0"  // 1561
+    "showed\0"  // 1562
+    "refused\0"  // 1563
+    "courtesy\0"  // 1564
+    "wanted\0"  // 1565
+    "situation\0"  // 1566
+    "foolishness\0"  // 1567
+    "log\0"  // 1568
+    "above\0"  // 1569
+    "rudeness\0"  // 1570
+    "introductions\0"  // 1571
+    "observed\0"  // 1572
+    "adventures\0"  // 1573
+    "marks\0"  // 1574
+    "sherlock\0"  // 1575
+    "defective\0"  // 1576
+    "adler\0"  // 1577
+    "involved\0"  // 1578
+    "k\0"  // 1579
+    "speckled\0"  // 1580
+    "colonel\0"  // 1581
+    "copper\0"  // 1582
+    "spoken\0"  // 1583
+    "safety\0"  // 1584
+    "george\0"  // 1585
+    "priuate\0"  // 1586
+    "obey\0"  // 1587
+    "key\0"  // 1588
+    "weary\0"  // 1589
+    "trouble\0"  // 1590
+    "dispaire\0"  // 1591
+    "outward\0"  // 1592
+    "violence\0"  // 1593
+    "suspect\0"  // 1594
+    "mercie\0"  // 1595
+    "wrath\0"  // 1596
+    "conclusion\0"  // 1597
+    "roome\0"  // 1598
+    "sentence\0"  // 1599
+    "kindly\0"  // 1600
+    "woes\0"  // 1601
+    "likely\0"  // 1602
+    "supper\0"  // 1603
+    "weapon\0"  // 1604
+    "whereof\0"  // 1605
+    "feares\0"  // 1606
+    "sees\0"  // 1607
+    "suit\0"  // 1608
+    "speaking\0"  // 1609
+    "greatnesse\0"  // 1610
+    "steele\0"  // 1611
+    "dar\0"  // 1612
+    "wing\0"  // 1613
+    "dignity\0"  // 1614
+    "wilde\0"  // 1615
+    "sometime\0"  // 1616
+    "runne\0"  // 1617
+    "burne\0"  // 1618
+    "sold\0"  // 1619
+    "lands\0"  // 1620
+    "cease\0"  // 1621
+    "ll\0"  // 1622
+    "form\0"  // 1623
+    "pleas\0"  // 1624
+    "stronger\0"  // 1625
+    "suspected\0"  // 1626
+    "temper\0"  // 1627
+    "ordinary\0"  // 1628
+    "try\0"  // 1629
+    "gaunt\0"  // 1630
+    "eight\0"  // 1631
+    "regard\0"  // 1632
+    "ist\0"  // 1633
+    "neck\0"  // 1634
+    "bread\0"  // 1635
+    "woods\0"  // 1636
+    "flower\0"  // 1637
+    "sooner\0"  // 1638
+    "phrase\0"  // 1639
+    "carried\0"  // 1640
+    "flattery\0"  // 1641
+    "cyprus\0"  // 1642
+    "buried\0"  // 1643
+    "delight\0"  // 1644
+    "got\0"  // 1645
+    "lip\0"  // 1646
+    "doo\0"  // 1647
+    "ghost\0"  // 1648
+    "brest\0"  // 1649
+    "cries\0"  // 1650
+    "circumstance\0"  // 1651
+    "begge\0"  // 1652
+    "shine\0"  // 1653
+    "growne\0"  // 1654
+    "liu\0"  // 1655
+    "seal\0"  // 1656
+    "sodaine\0"  // 1657
+    "faithfull\0"  // 1658
+    "breefe\0"  // 1659
+    "commission\0"  // 1660
+    "remorse\0"  // 1661
+    "dies\0"  // 1662
+    "traitor\0"  // 1663
+    "former\0"  // 1664
+    "hollow\0"  // 1665
+    "foe\0"  // 1666
+    "breach\0"  // 1667
+    "weigh\0"  // 1668
+    "triumph\0"  // 1669
+    "counterfeit\0"  // 1670
+    "brings\0"  // 1671
+    "mightie\0"  // 1672
+    "sorry\0"  // 1673
+    "heeles\0"  // 1674
+    "shot\0"  // 1675
+    "smiling\0"  // 1676
+    "borrowed\0"  // 1677
+    "skin\0"  // 1678
+    "bestow\0"  // 1679
+    "cosen\0"  // 1680
+    "instrument\0"  // 1681
+    "perchance\0"  // 1682
+    "finding\0"  // 1683
+    "struck\0"  // 1684
+    "beyond\0"  // 1685
+    "companion\0"  // 1686
+    "otherwise\0"  // 1687
+    "complexion\0"  // 1688
+    "anger\0"  // 1689
+    "seems\0"  // 1690
+    "necessary\0"  // 1691
+    "peculiar\0"  // 1692
+    "station\0"  // 1693
+    "errors\0"  // 1694
+    "isabell\0"  // 1695
+    "mystery\0"  // 1696
+    "fright\0"  // 1697
+    "dreames\0"  // 1698
+    "shore\0"  // 1699
+    "betray\0"  // 1700
+    "shortly\0"  // 1701
+    "abroad\0"  // 1702
+    "lancaster\0"  // 1703
+    "view\0"  // 1704
+    "deede\0"  // 1705
+    "sorrowes\0"  // 1706
+    "forgiue\0"  // 1707
+    "meaning\0"  // 1708
+    "neede\0"  // 1709
+    "blunt\0"  // 1710
+    "paine\0"  // 1711
+    "northumberland\0"  // 1712
+    "top\0"  // 1713
+    "peece\0"  // 1714
+    "stranger\0"  // 1715
+    "spare\0"  // 1716
+    "wake\0"  // 1717
+    "humor\0"  // 1718
+    "tall\0"  // 1719
+    "thunder\0"  // 1720
+    "start\0"  // 1721
+    "bare\0"  // 1722
+    "prayers\0"  // 1723
+    "chide\0"  // 1724
+    "nine\0"  // 1725
+    "forbid\0"  // 1726
+    "monstrous\0"  // 1727
+    "smiles\0"  // 1728
+    "proceed\0"  // 1729
+    "extreme\0"  // 1730
+    "heire\0"  // 1731
+    "ignorance\0"  // 1732
+    "tame\0"  // 1733
+    "leade\0"  // 1734
+    "goodnight\0"  // 1735
+    "twice\0"  // 1736
+    "ago\0"  // 1737
+    "owe\0"  // 1738
+    "lyon\0"  // 1739
+    "confronted\0"  // 1740
+    "becomes\0"  // 1741
+    "deuise\0"  // 1742
+    "later\0"  // 1743
+    "scoena\0"  // 1744
+    "burning\0"  // 1745
+    "game\0"  // 1746
+    "break\0"  // 1747
+    "boots\0"  // 1748
+    "yond\0"  // 1749
+    "crownes\0"  // 1750
+    "yeare\0"  // 1751
+    "gloue\0"  // 1752
+    "assembly\0"  // 1753
+    "affection\0"  // 1754
+    "ioue\0"  // 1755
+    "satisfaction\0"  // 1756
+    "distance\0"  // 1757
+    "pursue\0"  // 1758
+    "orange\0"  // 1759
+    "murderer\0"  // 1760
+    "places\0"  // 1761
+    "simplicity\0"  // 1762
+    "cheese\0"  // 1763
+    "thirst\0"  // 1764
+    "ophelia\0"  // 1765
+    "remembrances\0"  // 1766
+    "feel\0"  // 1767
+    "gent\0"  // 1768
+    "entirely\0"  // 1769
+    "wealthy\0"  // 1770
+    "smooth\0"  // 1771
+    "glasse\0"  // 1772
+    "shadow\0"  // 1773
+    "commit\0"  // 1774
+    "figure\0"  // 1775
+    "loe\0"  // 1776
+    "begger\0"  // 1777
+    "cheekes\0"  // 1778
+    "drawne\0"  // 1779
+    "trees\0"  // 1780
+    "thence\0"  // 1781
+    "happinesse\0"  // 1782
+    "mistake\0"  // 1783
+    "earnest\0"  // 1784
+    "dry\0"  // 1785
+    "ours\0"  // 1786
+    "knife\0"  // 1787
+    "bids\0"  // 1788
+    "bottome\0"  // 1789
+    "flood\0"  // 1790
+    "spake\0"  // 1791
+    "hearke\0"  // 1792
+    "husbands\0"  // 1793
+    "vrg\0"  // 1794
+    "twill\0"  // 1795
+    "thomas\0"  // 1796
+    "famous\0"  // 1797
+    "gifts\0"  // 1798
+    "seuerall\0"  // 1799
+    "withdraw\0"  // 1800
+    "wanton\0"  // 1801
+    "beat\0"  // 1802
+    "assistance\0"  // 1803
+    "trumpet\0"  // 1804
+    "blow\0"  // 1805
+    "earle\0"  // 1806
+    "bodies\0"  // 1807
+    "beginning\0"  // 1808
+    "peter\0"  // 1809
+    "maiden\0"  // 1810
+    "visited\0"  // 1811
+    "blowes\0"  // 1812
+    "bawd\0"  // 1813
+    "tune\0"  // 1814
+    "instant\0"  // 1815
+    "gain\0"  // 1816
+    "horrible\0"  // 1817
+    "supply\0"  // 1818
+    "violent\0"  // 1819
+    "aumerle\0"  // 1820
+    "olde\0"  // 1821
+    "mend\0"  // 1822
+    "render\0"  // 1823
+    "narrow\0"  // 1824
+    "sitting\0"  // 1825
+    "mountague\0"  // 1826
+    "asking\0"  // 1827
+    "athens\0"  // 1828
+    "discretion\0"  // 1829
+    "fairy\0"  // 1830
+    "box\0"  // 1831
+    "titinius\0"  // 1832
+    "rosalinde\0"  // 1833
+    "less\0"  // 1834
+    "leonato\0"  // 1835
+    "near\0"  // 1836
+    "morality\0"  // 1837
+    "jackdaw\0"  // 1838
+    "filled\0"  // 1839
+    "unto\0"  // 1840
+    "understand\0"  // 1841
+    "deceive\0"  // 1842
+    "humiliated\0"  // 1843
+    "importation\0"  // 1844
+    "cloak\0"  // 1845
+    "efforts\0"  // 1846
+    "concerns\0"  // 1847
+    "dropped\0"  // 1848
+    "distress\0"  // 1849
+    "receive\0"  // 1850
+    "policy\0"  // 1851
+    "readily\0"  // 1852
+    "arrived\0"  // 1853
+    "deceived\0"  // 1854
+    "idleness\0"  // 1855
+    "observe\0"  // 1856
+    "contemptible\0"  // 1857
+    "trying\0"  // 1858
+    "leaving\0"  // 1859
+    "shows\0"  // 1860
+    "kindness\0"  // 1861
+    "released\0"  // 1862
+    "real\0"  // 1863
+    "private\0"  // 1864
+    "itself\0"  // 1865
+    "someone\0"  // 1866
+    "believed\0"  // 1867
+    "dear\0"  // 1868
+    "lessons\0"  // 1869
+    "mannered\0"  // 1870
+    "parlor\0"  // 1871
+    "brief\0"  // 1872
+    "floor\0"  // 1873
+    "judgment\0"  // 1874
+    "clean\0"  // 1875
+    "scandal\0"  // 1876
+    "advice\0"  // 1877
+    "jewel\0"  // 1878
+    "glues\0"  // 1879
+    "irene\0"  // 1880
+    "valuable\0"  // 1881
+    "criminals\0"  // 1882
+    "hosmer\0"  // 1883
+    "disappeared\0"  // 1884
+    "evidence\0"  // 1885
+    "deduced\0"  // 1886
+    "pips\0"  // 1887
+    "elias\0"  // 1888
+    "investigated\0"  // 1889
+    "substantial\0"  // 1890
+    "carbuncle\0"  // 1891
+    "peterson\0"  // 1892
+    "hydraulic\0"  // 1893
+    "beryls\0"  // 1894
+    "beeches\0"  // 1895
+    "persons\0"  // 1896
+    "protest\0"  // 1897
+    "humble\0"  // 1898
+    "lawfull\0"  // 1899
+    "wounds\0"  // 1900
+    "n\0"  // 1901
+    "vengeance\0"  // 1902
+    "encounter\0"  // 1903
+    "salt\0"  // 1904
+    "flatter\0"  // 1905
+    "humour\0"  // 1906
+    "malice\0"  // 1907
+    "banishment\0"  // 1908
+    "self\0"  // 1909
+    "painted\0"  // 1910
+    "garments\0"  // 1911
+    "quarta\0"  // 1912
+    "help\0"  // 1913
+    "seale\0"  // 1914
+    "lest\0"  // 1915
+    "hardly\0"  // 1916
+    "shallow\0"  // 1917
+    "protect\0"  // 1918
+    "messenger\0"  // 1919
+    "dagger\0"  // 1920
+    "gift\0"  // 1921
+    "garden\0"  // 1922
+    "hid\0"  // 1923
+    "delay\0"  // 1924
+    "ones\0"  // 1925
+    "necke\0"  // 1926
+    "fellowes\0"  // 1927
+    "blew\0"  // 1928
+    "except\0"  // 1929
+    "attempt\0"  // 1930
+    "sits\0"  // 1931
+    "ciuill\0"  // 1932
+    "giuing\0"  // 1933
+    "vulgar\0"  // 1934
+    "solemnity\0"  // 1935
+    "twixt\0"  // 1936
+    "absent\0"  // 1937
+    "remedie\0"  // 1938
+    "consideration\0"  // 1939
+    "forced\0"  // 1940
+    "smell\0"  // 1941
+    "nation\0"  // 1942
+    "fury\0"  // 1943
+    "turned\0"  // 1944
+    "freely\0"  // 1945
+    "neglected\0"  // 1946
+    "bonnet\0"  // 1947
+    "plate\0"  // 1948
+    "household\0"  // 1949
+    "venice\0"  // 1950
+    "wisely\0"  // 1951
+    "drown\0"  // 1952
+    "piece\0"  // 1953
+    "ran\0"  // 1954
+    "assistant\0"  // 1955
+    "whore\0"  // 1956
+    "offered\0"  // 1957
+    "sum\0"  // 1958
+    "houses\0"  // 1959
+    "bringing\0"  // 1960
+    "thisby\0"  // 1961
+    "hey\0"  // 1962
+    "romans\0"  // 1963
+    "paid\0"  // 1964
+    "octauius\0"  // 1965
+    "messala\0"  // 1966
+    "deadly\0"  // 1967
+    "intent\0"  // 1968
+    "followes\0"  // 1969
+    "graces\0"  // 1970
+    "bend\0"  // 1971
+    "fac\0"  // 1972
+    "raine\0"  // 1973
+    "offers\0"  // 1974
+    "seruant\0"  // 1975
+    "farwell\0"  // 1976
+    "wofull\0"  // 1977
+    "although\0"  // 1978
+    "sicknesse\0"  // 1979
+    "abus\0"  // 1980
+    "riuers\0"  // 1981
+    "honors\0"  // 1982
+    "accident\0"  // 1983
+    "mou\0"  // 1984
+    "falling\0"  // 1985
+    "maine\0"  // 1986
+    "drowne\0"  // 1987
+    "elbow\0"  // 1988
+    "thriue\0"  // 1989
+    "hidden\0"  // 1990
+    "vnkle\0"  // 1991
+    "direct\0"  // 1992
+    "henry\0"  // 1993
+    "aye\0"  // 1994
+    "hers\0"  // 1995
+    "benefit\0"  // 1996
+    "conceit\0"  // 1997
+    "hatefull\0"  // 1998
+    "appetite\0"  // 1999
+    "citie\0"  // 2000
+    "reproach\0"  // 2001
+    "braines\0"  // 2002
+    "tempt\0"  // 2003
+    "twentie\0"  // 2004
+    "neighbor\0"  // 2005
+    "rash\0"  // 2006
+    "morne\0"  // 2007
+    "choose\0"  // 2008
+    "cure\0"  // 2009
+    "touching\0"  // 2010
+    "defence\0"  // 2011
+    "womans\0"  // 2012
+    "huge\0"  // 2013
+    "line\0"  // 2014
+    "mettle\0"  // 2015
+    "religion\0"  // 2016
+    "spight\0"  // 2017
+    "plucke\0"  // 2018
+    "putting\0"  // 2019
+    "presented\0"  // 2020
+    "circle\0"  // 2021
+    "affections\0"  // 2022
+    "clearly\0"  // 2023
+    "braine\0"  // 2024
+    "happily\0"  // 2025
+    "familiar\0"  // 2026
+    "challenge\0"  // 2027
+    "vnfold\0"  // 2028
+    "female\0"  // 2029
+    "profit\0"  // 2030
+    "termes\0"  // 2031
+    "visage\0"  // 2032
+    "courteous\0"  // 2033
+    "rogue\0"  // 2034
+    "players\0"  // 2035
+    "lying\0"  // 2036
+    "reading\0"  // 2037
+    "bear\0"  // 2038
+    "papers\0"  // 2039
+    "roman\0"  // 2040
+    "lucius\0"  // 2041
+    "degrees\0"  // 2042
+    "faithful\0"  // 2043
+    "denmarke\0"  // 2044
+    "desart\0"  // 2045
+    "coming\0"  // 2046
+    "important\0"  // 2047
+    "wrote\0"  // 2048
+    "diligence\0"  // 2049
+    "cesario\0"  // 2050
+    "members\0"  // 2051
+    "raised\0"  // 2052
+    "browes\0"  // 2053
+    "begins\0"  // 2054
+    "harsh\0"  // 2055
+    "whence\0"  // 2056
+    "secure\0"  // 2057
+    "kindred\0"  // 2058
+    "libertie\0"  // 2059
+    "perforce\0"  // 2060
+    "melancholly\0"  // 2061
+    "post\0"  // 2062
+    "cursed\0"  // 2063
+    "miserable\0"  // 2064
+    "blinde\0"  // 2065
+    "enuious\0"  // 2066
+    "faces\0"  // 2067
+    "prey\0"  // 2068
+    "falne\0"  // 2069
+    "slander\0"  // 2070
+    "flourish\0"  // 2071
+    "vantage\0"  // 2072
+    "stolne\0"  // 2073
+    "tempest\0"  // 2074
+    "consider\0"  // 2075
+    "peeres\0"  // 2076
+    "punish\0"  // 2077
+    "doome\0"  // 2078
+    "ioyne\0"  // 2079
+    "stanley\0"  // 2080
+    "castle\0"  // 2081
+    "twelue\0"  // 2082
+    "perill\0"  // 2083
+    "citizens\0"  // 2084
+    "fairely\0"  // 2085
+    "accept\0"  // 2086
+    "led\0"  // 2087
+    "feed\0"  // 2088
+    "wings\0"  // 2089
+    "admit\0"  // 2090
+    "couer\0"  // 2091
+    "exeter\0"  // 2092
+    "fought\0"  // 2093
+    "dew\0"  // 2094
+    "robert\0"  // 2095
+    "inheritance\0"  // 2096
+    "habit\0"  // 2097
+    "practice\0"  // 2098
+    "thanks\0"  // 2099
+    "theirs\0"  // 2100
+    "wrought\0"  // 2101
+    "amaz\0"  // 2102
+    "flat\0"  // 2103
+    "possessed\0"  // 2104
+    "powers\0"  // 2105
+    "different\0"  // 2106
+    "directly\0"  // 2107
+    "actions\0"  // 2108
+    "seek\0"  // 2109
+    "promis\0"  // 2110
+    "lock\0"  // 2111
+    "herford\0"  // 2112
+    "accused\0"  // 2113
+    "elsewhere\0"  // 2114
+    "somewhat\0"  // 2115
+    "runs\0"  // 2116
+    "sighes\0"  // 2117
+    "hanging\0"  // 2118
+    "cell\0"  // 2119
+    "dark\0"  // 2120
+    "valley\0"  // 2121
+    "simply\0"  // 2122
+    "breakfast\0"  // 2123
+    "admiration\0"  // 2124
+    "required\0"  // 2125
+    "il\0"  // 2126
+    "countenance\0"  // 2127
+    "ranke\0"  // 2128
+    "capitoll\0"  // 2129
+    "quality\0"  // 2130
+    "beu\0"  // 2131
+    "outside\0"  // 2132
+    "missing\0"  // 2133
+    "phebe\0"  // 2134
+    "instead\0"  // 2135
+    "size\0"  // 2136
+    "stream\0"  // 2137
+    "lesson\0"  // 2138
+    "continued\0"  // 2139
+    "stolen\0"  // 2140
+    "disguised\0"  // 2141
+    "worne\0"  // 2142
+    "naught\0"  // 2143
+    "vrge\0"  // 2144
+    "powre\0"  // 2145
+    "coarse\0"  // 2146
+    "tremble\0"  // 2147
+    "blush\0"  // 2148
+    "sharpe\0"  // 2149
+    "heauenly\0"  // 2150
+    "heereafter\0"  // 2151
+    "cost\0"  // 2152
+    "assur\0"  // 2153
+    "telling\0"  // 2154
+    "affaires\0"  // 2155
+    "thereof\0"  // 2156
+    "enioy\0"  // 2157
+    "dorset\0"  // 2158
+    "taught\0"  // 2159
+    "hopes\0"  // 2160
+    "sooth\0"  // 2161
+    "wait\0"  // 2162
+    "angell\0"  // 2163
+    "trembling\0"  // 2164
+    "vntill\0"  // 2165
+    "wont\0"  // 2166
+    "cup\0"  // 2167
+    "slow\0"  // 2168
+    "treasure\0"  // 2169
+    "pluck\0"  // 2170
+    "intend\0"  // 2171
+    "easie\0"  // 2172
+    "richards\0"  // 2173
+    "wear\0"  // 2174
+    "talking\0"  // 2175
+    "wants\0"  // 2176
+    "absence\0"  // 2177
+    "ely\0"  // 2178
+    "readie\0"  // 2179
+    "ambition\0"  // 2180
+    "reuerence\0"  // 2181
+    "burthen\0"  // 2182
+    "meere\0"  // 2183
+    "partly\0"  // 2184
+    "scope\0"  // 2185
+    "guide\0"  // 2186
+    "expedition\0"  // 2187
+    "quit\0"  // 2188
+    "slip\0"  // 2189
+    "armour\0"  // 2190
+    "hit\0"  // 2191
+    "enterprize\0"  // 2192
+    "necessity\0"  // 2193
+    "reuolt\0"  // 2194
+    "assurance\0"  // 2195
+    "officers\0"  // 2196
+    "colours\0"  // 2197
+    "dwell\0"  // 2198
+    "ransome\0"  // 2199
+    "beaten\0"  // 2200
+    "war\0"  // 2201
+    "begun\0"  // 2202
+    "den\0"  // 2203
+    "strongly\0"  // 2204
+    "lyons\0"  // 2205
+    "passage\0"  // 2206
+    "cal\0"  // 2207
+    "list\0"  // 2208
+    "meeting\0"  // 2209
+    "forsworne\0"  // 2210
+    "plaid\0"  // 2211
+    "audience\0"  // 2212
+    "goods\0"  // 2213
+    "leane\0"  // 2214
+    "smallest\0"  // 2215
+    "mirth\0"  // 2216
+    "wounded\0"  // 2217
+    "parted\0"  // 2218
+    "impossible\0"  // 2219
+    "generally\0"  // 2220
+    "article\0"  // 2221
+    "greatly\0"  // 2222
+    "companions\0"  // 2223
+    "mercutio\0"  // 2224
+    "dogs\0"  // 2225
+    "choice\0"  // 2226
+    "modestie\0"  // 2227
+    "vault\0"  // 2228
+    "custome\0"  // 2229
+    "dishonest\0"  // 2230
+    "delicate\0"  // 2231
+    "cases\0"  // 2232
+    "que\0"  // 2233
+    "non\0"  // 2234
+    "sex\0"  // 2235
+    "censure\0"  // 2236
+    "4\0"  // 2237
+    "topas\0"  // 2238
+    "barnardine\0"  // 2239
+    "five\0"  // 2240
+    "nearly\0"  // 2241
+    "knaves\0"  // 2242
+    "moreover\0"  // 2243
+    "æsop\0"  // 2244
+    "mere\0"  // 2245
+    "unable\0"  // 2246
+    "traveller\0"  // 2247
+    "corn\0"  // 2248
+    "piteously\0"  // 2249
+    "begged\0"  // 2250
+    "grasshopper\0"  // 2251
+    "ways\0"  // 2252
+    "prove\0"  // 2253
+    "awakened\0"  // 2254
+    "offense\0"  // 2255
+    "rope\0"  // 2256
+    "diligently\0"  // 2257
+    "decided\0"  // 2258
+    "behavior\0"  // 2259
+    "easy\0"  // 2260
+    "actually\0"  // 2261
+    "sensibly\0"  // 2262
+    "evil\0"  // 2263
+    "seemed\0"  // 2264
+    "victim\0"  // 2265
+    "enjoyed\0"  // 2266
+    "vigilance\0"  // 2267
+    "live\0"  // 2268
+    "treatise\0"  // 2269
+    "po\0"  // 2270
+    "lightness\0"  // 2271
+    "respectacle\0"  // 2272
+    "comprehension\0"  // 2273
+    "servant\0"  // 2274
+    "preserve\0"  // 2275
+    "hour\0"  // 2276
+    "handkerchief\0"  // 2277
+    "removed\0"  // 2278
+    "remark\0"  // 2279
+    "introduce\0"  // 2280
+    "until\0"  // 2281
+    "inexcusable\0"  // 2282
+    "colored\0"  // 2283
+    "unless\0"  // 2284
+    "dressed\0"  // 2285
+    "deference\0"  // 2286
+    "cleanliness\0"  // 2287
+    "personal\0"  // 2288
+    "superior\0"  // 2289
+    "slang\0"  // 2290
+    "envelope\0"  // 2291
+    "invitation\0"  // 2292
+    "arranged\0"  // 2293
+    "fail\0"  // 2294
+    "polite\0"  // 2295
+    "partners\0"  // 2296
+    "however\0"  // 2297
+    "advertisement\0"  // 2298
+    "accepted\0"  // 2299
+    "chess\0"  // 2300
+    "essential\0"  // 2301
+    "employers\0"  // 2302
+    "designed\0"  // 2303
+    "detective\0"  // 2304
+    "preserved\0"  // 2305
+    "seduction\0"  // 2306
+    "clues\0"  // 2307
+    "bohemia\0"  // 2308
+    "confessed\0"  // 2309
+    "explaining\0"  // 2310
+    "moved\0"  // 2311
+    "items\0"  // 2312
+    "weeks\0"  // 2313
+    "boscombe\0"  // 2314
+    "respectable\0"  // 2315
+    "america\0"  // 2316
+    "opium\0"  // 2317
+    "blue\0"  // 2318
+    "managed\0"  // 2319
+    "stepfather\0"  // 2320
+    "ventilator\0"  // 2321
+    "painfully\0"  // 2322
+    "gems\0"  // 2323
+    "hung\0"  // 2324
+    "sends\0"  // 2325
+    "widdow\0"  // 2326
+    "iealious\0"  // 2327
+    "hatred\0"  // 2328
+    "whil\0"  // 2329
+    "stab\0"  // 2330
+    "vnnaturall\0"  // 2331
+    "villaines\0"  // 2332
+    "wonderfull\0"  // 2333
+    "vouchsafe\0"  // 2334
+    "slew\0"  // 2335
+    "guilt\0"  // 2336
+    "deaths\0"  // 2337
+    "finger\0"  // 2338
+    "deserue\0"  // 2339
+    "woo\0"  // 2340
+    "winne\0"  // 2341
+    "blest\0"  // 2342
+    "height\0"  // 2343
+    "dread\0"  // 2344
+    "louely\0"  // 2345
+    "reply\0"  // 2346
+    "ends\0"  // 2347
+    "turnes\0"  // 2348
+    "deuill\0"  // 2349
+    "reward\0"  // 2350
+    "deuice\0"  // 2351
+    "bloudy\0"  // 2352
+    "friendship\0"  // 2353
+    "embrace\0"  // 2354
+    "conclude\0"  // 2355
+    "opposite\0"  // 2356
+    "requires\0"  // 2357
+    "firme\0"  // 2358
+    "determine\0"  // 2359
+    "wearie\0"  // 2360
+    "denie\0"  // 2361
+    "entreat\0"  // 2362
+    "possest\0"  // 2363
+    "north\0"  // 2364
+    "fatall\0"  // 2365
+    "standing\0"  // 2366
+    "behalfe\0"  // 2367
+    "traytor\0"  // 2368
+    "whit\0"  // 2369
+    "begot\0"  // 2370
+    "deputie\0"  // 2371
+    "bent\0"  // 2372
+    "ornaments\0"  // 2373
+    "refuse\0"  // 2374
+    "seas\0"  // 2375
+    "rid\0"  // 2376
+    "boyes\0"  // 2377
+    "foes\0"  // 2378
+    "compassion\0"  // 2379
+    "gray\0"  // 2380
+    "patiently\0"  // 2381
+    "battell\0"  // 2382
+    "whisper\0"  // 2383
+    "princesse\0"  // 2384
+    "sweetly\0"  // 2385
+    "breed\0"  // 2386
+    "elder\0"  // 2387
+    "east\0"  // 2388
+    "felt\0"  // 2389
+    "fat\0"  // 2390
+    "proclaime\0"  // 2391
+    "claime\0"  // 2392
+    "ambitious\0"  // 2393
+    "durst\0"  // 2394
+    "sell\0"  // 2395
+    "drawes\0"  // 2396
+    "prepar\0"  // 2397
+    "tread\0"  // 2398
+    "triall\0"  // 2399
+    "confusion\0"  // 2400
+    "sought\0"  // 2401
+    "eie\0"  // 2402
+    "departed\0"  // 2403
+    "drawing\0"  // 2404
+    "sway\0"  // 2405
+    "haile\0"  // 2406
+    "vilde\0"  // 2407
+    "serpent\0"  // 2408
+    "constant\0"  // 2409
+    "yesterday\0"  // 2410
+    "wealth\0"  // 2411
+    "acte\0"  // 2412
+    "coniure\0"  // 2413
+    "beshrew\0"  // 2414
+    "doores\0"  // 2415
+    "mowbray\0"  // 2416
+    "gage\0"  // 2417
+    "crop\0"  // 2418
+    "suffering\0"  // 2419
+    "em\0"  // 2420
+    "calls\0"  // 2421
+    "wooe\0"  // 2422
+    "kisses\0"  // 2423
+    "cals\0"  // 2424
+    "abuse\0"  // 2425
+    "wearing\0"  // 2426
+    "meat\0"  // 2427
+    "honestie\0"  // 2428
+    "yellow\0"  // 2429
+    "pistoll\0"  // 2430
+    "alexander\0"  // 2431
+    "pre\0"  // 2432
+    "andrew\0"  // 2433
+    "glorious\0"  // 2434
+    "barke\0"  // 2435
+    "determined\0"  // 2436
+    "rul\0"  // 2437
+    "disgrace\0"  // 2438
+    "imagine\0"  // 2439
+    "wench\0"  // 2440
+    "leysure\0"  // 2441
+    "accuse\0"  // 2442
+    "beate\0"  // 2443
+    "spit\0"  // 2444
+    "drops\0"  // 2445
+    "warlike\0"  // 2446
+    "stroke\0"  // 2447
+    "arise\0"  // 2448
+    "wonne\0"  // 2449
+    "findes\0"  // 2450
+    "recouer\0"  // 2451
+    "glouster\0"  // 2452
+    "prayer\0"  // 2453
+    "desert\0"  // 2454
+    "countries\0"  // 2455
+    "drew\0"  // 2456
+    "slay\0"  // 2457
+    "rights\0"  // 2458
+    "neyther\0"  // 2459
+    "sinnes\0"  // 2460
+    "worlds\0"  // 2461
+    "hadst\0"  // 2462
+    "execution\0"  // 2463
+    "tut\0"  // 2464
+    "tel\0"  // 2465
+    "asleepe\0"  // 2466
+    "tydings\0"  // 2467
+    "deceiu\0"  // 2468
+    "intreat\0"  // 2469
+    "bene\0"  // 2470
+    "seruants\0"  // 2471
+    "pluckt\0"  // 2472
+    "guesse\0"  // 2473
+    "lent\0"  // 2474
+    "obedience\0"  // 2475
+    "grew\0"  // 2476
+    "gaine\0"  // 2477
+    "trumpets\0"  // 2478
+    "cardinall\0"  // 2479
+    "dealings\0"  // 2480
+    "notice\0"  // 2481
+    "knot\0"  // 2482
+    "appeares\0"  // 2483
+    "barre\0"  // 2484
+    "priest\0"  // 2485
+    "scaena\0"  // 2486
+    "presume\0"  // 2487
+    "strumpet\0"  // 2488
+    "daughters\0"  // 2489
+    "hangs\0"  // 2490
+    "dealing\0"  // 2491
+    "ask\0"  // 2492
+    "maids\0"  // 2493
+    "afterward\0"  // 2494
+    "amisse\0"  // 2495
+    "pompe\0"  // 2496
+    "com\0"  // 2497
+    "graues\0"  // 2498
+    "bond\0"  // 2499
+    "below\0"  // 2500
+    "lights\0"  // 2501
+    "bastard\0"  // 2502
+    "ireland\0"  // 2503
+    "tricke\0"  // 2504
+    "concludes\0"  // 2505
+    "beside\0"  // 2506
+    "legs\0"  // 2507
+    "dares\0"  // 2508
+    "angiers\0"  // 2509
+    "adde\0"  // 2510
+    "properly\0"  // 2511
+    "palme\0"  // 2512
+    "saile\0"  // 2513
+    "example\0"  // 2514
+    "minute\0"  // 2515
+    "heate\0"  // 2516
+    "sung\0"  // 2517
+    "twisted\0"  // 2518
+    "faint\0"  // 2519
+    "whereto\0"  // 2520
+    "remaine\0"  // 2521
+    "imagination\0"  // 2522
+    "feede\0"  // 2523
+    "speciall\0"  // 2524
+    "theeues\0"  // 2525
+    "theefe\0"  // 2526
+    "noyse\0"  // 2527
+    "tombe\0"  // 2528
+    "oathes\0"  // 2529
+    "formes\0"  // 2530
+    "sisters\0"  // 2531
+    "countie\0"  // 2532
+    "constables\0"  // 2533
+    "playing\0"  // 2534
+    "rat\0"  // 2535
+    "murdered\0"  // 2536
+    "calling\0"  // 2537
+    "thursday\0"  // 2538
+    "athenian\0"  // 2539
+    "india\0"  // 2540
+    "main\0"  // 2541
+    "murderers\0"  // 2542
+    "hunger\0"  // 2543
+    "knows\0"  // 2544
+    "trick\0"  // 2545
+    "ignorant\0"  // 2546
+    "oliuia\0"  // 2547
+    "four\0"  // 2548
+    "sins\0"  // 2549
+    "willough\0"  // 2550
+    "belike\0"  // 2551
+    "betwixt\0"  // 2552
+    "faile\0"  // 2553
+    "angels\0"  // 2554
+    "rous\0"  // 2555
+    "vndertake\0"  // 2556
+    "vnknowne\0"  // 2557
+    "lightly\0"  // 2558
+    "kingdomes\0"  // 2559
+    "peeuish\0"  // 2560
+    "seest\0"  // 2561
+    "spend\0"  // 2562
+    "sowre\0"  // 2563
+    "greet\0"  // 2564
+    "titles\0"  // 2565
+    "legges\0"  // 2566
+    "sleepes\0"  // 2567
+    "meddle\0"  // 2568
+    "heed\0"  // 2569
+    "destroy\0"  // 2570
+    "ratcliffe\0"  // 2571
+    "purchase\0"  // 2572
+    "hood\0"  // 2573
+    "leaues\0"  // 2574
+    "barren\0"  // 2575
+    "debt\0"  // 2576
+    "craue\0"  // 2577
+    "strait\0"  // 2578
+    "manet\0"  // 2579
+    "direction\0"  // 2580
+    "pomfret\0"  // 2581
+    "nobles\0"  // 2582
+    "attended\0"  // 2583
+    "maior\0"  // 2584
+    "summers\0"  // 2585
+    "employ\0"  // 2586
+    "kindnesse\0"  // 2587
+    "betimes\0"  // 2588
+    "doest\0"  // 2589
+    "bolder\0"  // 2590
+    "accompanied\0"  // 2591
+    "pitch\0"  // 2592
+    "howre\0"  // 2593
+    "wed\0"  // 2594
+    "suddenly\0"  // 2595
+    "fierie\0"  // 2596
+    "skill\0"  // 2597
+    "compare\0"  // 2598
+    "style\0"  // 2599
+    "garter\0"  // 2600
+    "west\0"  // 2601
+    "army\0"  // 2602
+    "mount\0"  // 2603
+    "midnight\0"  // 2604
+    "crying\0"  // 2605
+    "whip\0"  // 2606
+    "philip\0"  // 2607
+    "possession\0"  // 2608
+    "treat\0"  // 2609
+    "kneele\0"  // 2610
+    "dispose\0"  // 2611
+    "articles\0"  // 2612
+    "walles\0"  // 2613
+    "lustie\0"  // 2614
+    "monster\0"  // 2615
+    "display\0"  // 2616
+    "resolu\0"  // 2617
+    "industrious\0"  // 2618
+    "pate\0"  // 2619
+    "playes\0"  // 2620
+    "turning\0"  // 2621
+    "newly\0"  // 2622
+    "harke\0"  // 2623
+    "holding\0"  // 2624
+    "redresse\0"  // 2625
+    "possess\0"  // 2626
+    "violet\0"  // 2627
+    "occasions\0"  // 2628
+    "foundation\0"  // 2629
+    "whereon\0"  // 2630
+    "damnation\0"  // 2631
+    "receiu\0"  // 2632
+    "confused\0"  // 2633
+    "spot\0"  // 2634
+    "plot\0"  // 2635
+    "branch\0"  // 2636
+    "throwne\0"  // 2637
+    "obserue\0"  // 2638
+    "condemn\0"  // 2639
+    "prowd\0"  // 2640
+    "redemption\0"  // 2641
+    "wayes\0"  // 2642
+    "thrown\0"  // 2643
+    "suggested\0"  // 2644
+    "griefes\0"  // 2645
+    "capulet\0"  // 2646
+    "younger\0"  // 2647
+    "shut\0"  // 2648
+    "rosaline\0"  // 2649
+    "lucio\0"  // 2650
+    "merrie\0"  // 2651
+    "curious\0"  // 2652
+    "cocke\0"  // 2653
+    "changes\0"  // 2654
+    "gentlewoman\0"  // 2655
+    "iustly\0"  // 2656
+    "hunting\0"  // 2657
+    "practise\0"  // 2658
+    "warning\0"  // 2659
+    "iealousie\0"  // 2660
+    "prologue\0"  // 2661
+    "bill\0"  // 2662
+    "opening\0"  // 2663
+    "preferred\0"  // 2664
+    "fables\0"  // 2665
+    "cant\0"  // 2666
+    "natural\0"  // 2667
+    "charming\0"  // 2668
+    "leeke\0"  // 2669
+    "costume\0"  // 2670
+    "stare\0"  // 2671
+    "caius\0"  // 2672
+    "insisted\0"  // 2673
+    "hours\0"  // 2674
+    "soon\0"  // 2675
+    "abandon\0"  // 2676
+    "stockings\0"  // 2677
+    "machine\0"  // 2678
+    "grounds\0"  // 2679
+    "theft\0"  // 2680
+    "dirty\0"  // 2681
+    "orsino\0"  // 2682
+    "beautiful\0"  // 2683
+    "phrases\0"  // 2684
+    "dealer\0"  // 2685
+    "expose\0"  // 2686
+    "laws\0"  // 2687
+    "entering\0"  // 2688
+    "possessions\0"  // 2689
+    "aemilia\0"  // 2690
+    "express\0"  // 2691
+    "feature\0"  // 2692
+    "breathing\0"  // 2693
+    "scarse\0"  // 2694
+    "murtherer\0"  // 2695
+    "conuey\0"  // 2696
+    "grey\0"  // 2697
+    "iealous\0"  // 2698
+    "conference\0"  // 2699
+    "forbeare\0"  // 2700
+    "imprisonment\0"  // 2701
+    "market\0"  // 2702
+    "vntimely\0"  // 2703
+    "windowes\0"  // 2704
+    "fiend\0"  // 2705
+    "minister\0"  // 2706
+    "fowle\0"  // 2707
+    "lightning\0"  // 2708
+    "diuine\0"  // 2709
+    "vnworthy\0"  // 2710
+    "guiltlesse\0"  // 2711
+    "pause\0"  // 2712
+    "saide\0"  // 2713
+    "bleeding\0"  // 2714
+    "brooke\0"  // 2715
+    "cheere\0"  // 2716
+    "curtesie\0"  // 2717
+    "grandam\0"  // 2718
+    "mindes\0"  // 2719
+    "worme\0"  // 2720
+    "queen\0"  // 2721
+    "seru\0"  // 2722
+    "counsaile\0"  // 2723
+    "signe\0"  // 2724
+    "breakes\0"  // 2725
+    "tide\0"  // 2726
+    "fame\0"  // 2727
+    "killing\0"  // 2728
+    "looks\0"  // 2729
+    "hole\0"  // 2730
+    "buriall\0"  // 2731
+    "thin\0"  // 2732
+    "image\0"  // 2733
+    "blessing\0"  // 2734
+    "gently\0"  // 2735
+    "gouernment\0"  // 2736
+    "preuent\0"  // 2737
+    "destruction\0"  // 2738
+    "blowne\0"  // 2739
+    "deseru\0"  // 2740
+    "clayme\0"  // 2741
+    "fro\0"  // 2742
+    "sudden\0"  // 2743
+    "exercise\0"  // 2744
+    "neglect\0"  // 2745
+    "contract\0"  // 2746
+    "followers\0"  // 2747
+    "heartily\0"  // 2748
+    "fruit\0"  // 2749
+    "farther\0"  // 2750
+    "contrary\0"  // 2751
+    "possesse\0"  // 2752
+    "aduice\0"  // 2753
+    "reioyce\0"  // 2754
+    "consequence\0"  // 2755
+    "ice\0"  // 2756
+    "deale\0"  // 2757
+    "frowne\0"  // 2758
+    "society\0"  // 2759
+    "accent\0"  // 2760
+    "school\0"  // 2761
+    "rush\0"  // 2762
+    "harm\0"  // 2763
+    "lasting\0"  // 2764
+    "hearted\0"  // 2765
+    "salisbury\0"  // 2766
+    "bosomes\0"  // 2767
+    "tyranny\0"  // 2768
+    "slept\0"  // 2769
+    "share\0"  // 2770
+    "strikes\0"  // 2771
+    "greeting\0"  // 2772
+    "desiring\0"  // 2773
+    "arthurs\0"  // 2774
+    "yeere\0"  // 2775
+    "employment\0"  // 2776
+    "faithfully\0"  // 2777
+    "hether\0"  // 2778
+    "yfaith\0"  // 2779
+    "boast\0"  // 2780
+    "owner\0"  // 2781
+    "lets\0"  // 2782
+    "saist\0"  // 2783
+    "thereby\0"  // 2784
+    "weight\0"  // 2785
+    "hie\0"  // 2786
+    "labor\0"  // 2787
+    "laughter\0"  // 2788
+    "minutes\0"  // 2789
+    "stubborne\0"  // 2790
+    "hideous\0"  // 2791
+    "sides\0"  // 2792
+    "maides\0"  // 2793
+    "recompence\0"  // 2794
+    "flie\0"  // 2795
+    "mortality\0"  // 2796
+    "pen\0"  // 2797
+    "push\0"  // 2798
+    "immortall\0"  // 2799
+    "furnish\0"  // 2800
+    "remaines\0"  // 2801
+    "exile\0"  // 2802
+    "parting\0"  // 2803
+    "flatterers\0"  // 2804
+    "francis\0"  // 2805
+    "value\0"  // 2806
+    "gowne\0"  // 2807
+    "silly\0"  // 2808
+    "abide\0"  // 2809
+    "examine\0"  // 2810
+    "se\0"  // 2811
+    "mantua\0"  // 2812
+    "weele\0"  // 2813
+    "e\0"  // 2814
+    "birds\0"  // 2815
+    "confession\0"  // 2816
+    "baud\0"  // 2817
+    "aduise\0"  // 2818
+    "serpents\0"  // 2819
+    "verses\0"  // 2820
+    "rare\0"  // 2821
+    "mounsieur\0"  // 2822
+    "fluellen\0"  // 2823
+    "rascall\0"  // 2824
+    "en\0"  // 2825
+    "ingratitude\0"  // 2826
+    "walk\0"  // 2827
+    "gertrude\0"  // 2828
+    "respected\0"  // 2829
+    "friar\0"  // 2830
+    "thief\0"  // 2831
+    "verges\0"  // 2832
+    "soul\0"  // 2833
+    "ear\0"  // 2834
+    "looked\0"  // 2835
+    "sixth\0"  // 2836
+    "wished\0"  // 2837
+    "application\0"  // 2838
+    "honester\0"  // 2839
+    "findest\0"  // 2840
+    "incorrectly\0"  // 2841
+    "finery\0"  // 2842
+    "pretended\0"  // 2843
+    "humiliation\0"  // 2844
+    "claiming\0"  // 2845
+    "remove\0"  // 2846
+    "failure\0"  // 2847
+    "described\0"  // 2848
+    "merely\0"  // 2849
+    "dove\0"  // 2850
+    "silver\0"  // 2851
+    "gave\0"  // 2852
+    "deceptions\0"  // 2853
+    "provided\0"  // 2854
+    "soup\0"  // 2855
+    "meanwhile\0"  // 2856
+    "played\0"  // 2857
+    "extremely\0"  // 2858
+    "jar\0"  // 2859
+    "treated\0"  // 2860
+    "virtues\0"  // 2861
+    "worked\0"  // 2862
+    "expressions\0"  // 2863
+    "says\0"  // 2864
+    "severely\0"  // 2865
+    "consequences\0"  // 2866
+    "provide\0"  // 2867
+    "confess\0"  // 2868
+    "saved\0"  // 2869
+    "demonstrates\0"  // 2870
+    "beak\0"  // 2871
+    "pebble\0"  // 2872
+    "whatever\0"  // 2873
+    "lives\0"  // 2874
+    "rushed\0"  // 2875
+    "respectful\0"  // 2876
+    "around\0"  // 2877
+    "leaped\0"  // 2878
+    "active\0"  // 2879
+    "desperation\0"  // 2880
+    "replied\0"  // 2881
+    "themselves\0"  // 2882
+    "obtain\0"  // 2883
+    "walked\0"  // 2884
+    "waiting\0"  // 2885
+    "caw\0"  // 2886
+    "chopped\0"  // 2887
+    "believes\0"  // 2888
+    "endeth\0"  // 2889
+    "probably\0"  // 2890
+    "understands\0"  // 2891
+    "upholder\0"  // 2892
+    "brilliant\0"  // 2893
+    "particularly\0"  // 2894
+    "cheerful\0"  // 2895
+    "attentions\0"  // 2896
+    "deserve\0"  // 2897
+    "kinds\0"  // 2898
+    "congratulation\0"  // 2899
+    "twelve\0"  // 2900
+    "ungenteel\0"  // 2901
+    "unpardonable\0"  // 2902
+    "superiors\0"  // 2903
+    "gloves\0"  // 2904
+    "improper\0"  // 2905
+    "recognize\0"  // 2906
+    "jewels\0"  // 2907
+    "dresses\0"  // 2908
+    "various\0"  // 2909
+    "fair\0"  // 2910
+    "movements\0"  // 2911
+    "special\0"  // 2912
+    "abomination\0"  // 2913
+    "social\0"  // 2914
+    "smoke\0"  // 2915
+    "ridicule\0"  // 2916
+    "shown\0"  // 2917
+    "loved\0"  // 2918
+    "terms\0"  // 2919
+    "postage\0"  // 2920
+    "introduction\0"  // 2921
+    "week\0"  // 2922
+    "beforehand\0"  // 2923
+    "usual\0"  // 2924
+    "public\0"  // 2925
+    "explain\0"  // 2926
+    "realized\0"  // 2927
+    "dining\0"  // 2928
+    "politeness\0"  // 2929
+    "employees\0"  // 2930
+    "intercourse\0"  // 2931
+    "practical\0"  // 2932
+    "deduction\0"  // 2933
+    "baker\0"  // 2934
+    "advent\0"  // 2935
+    "chores\0"  // 2936
+    "identity\0"  // 2937
+    "revealed\0"  // 2938
+    "american\0"  // 2939
+    "encyclopedia\0"  // 2940
+    "pawnshop\0"  // 2941
+    "firmly\0"  // 2942
+    "clothing\0"  // 2943
+    "mysteriously\0"  // 2944
+    "income\0"  // 2945
+    "pool\0"  // 2946
+    "landowner\0"  // 2947
+    "convinced\0"  // 2948
+    "australia\0"  // 2949
+    "activities\0"  // 2950
+    "control\0"  // 2951
+    "openshaw\0"  // 2952
+    "ku\0"  // 2953
+    "klux\0"  // 2954
+    "recover\0"  // 2955
+    "attempted\0"  // 2956
+    "flee\0"  // 2957
+    "countess\0"  // 2958
+    "horner\0"  // 2959
+    "discovered\0"  // 2960
+    "unusual\0"  // 2961
+    "stoner\0"  // 2962
+    "engineer\0"  // 2963
+    "stark\0"  // 2964
+    "secrecy\0"  // 2965
+    "escaped\0"  // 2966
+    "beryl\0"  // 2967
+    "client\0"  // 2968
+    "governess\0"  // 2969
+    "locked\0"  // 2970
+    "savage\0"  // 2971
+    "sterne\0"  // 2972
+    "chang\0"  // 2973
+    "grim\0"  // 2974
+    "pleasing\0"  // 2975
+    "proportion\0"  // 2976
+    "treacherous\0"  // 2977
+    "partake\0"  // 2978
+    "touches\0"  // 2979
+    "lament\0"  // 2980
+    "aspect\0"  // 2981
+    "higher\0"  // 2982
+    "charity\0"  // 2983
+    "mouthes\0"  // 2984
+    "veines\0"  // 2985
+    "curses\0"  // 2986
+    "supposed\0"  // 2987
+    "lyest\0"  // 2988
+    "keene\0"  // 2989
+    "beauties\0"  // 2990
+    "sham\0"  // 2991
+    "store\0"  // 2992
+    "shooke\0"  // 2993
+    "royal\0"  // 2994
+    "bought\0"  // 2995
+    "gloster\0"  // 2996
+    "maide\0"  // 2997
+    "seate\0"  // 2998
+    "liberall\0"  // 2999
+    "busie\0"  // 3000
+    "altogether\0"  // 3001
+    "vsurpe\0"  // 3002
+    "prettie\0"  // 3003
+    "charme\0"  // 3004
+    "wither\0"  // 3005
+    "strew\0"  // 3006
+    "eternall\0"  // 3007
+    "compasse\0"  // 3008
+    "sore\0"  // 3009
+    "inward\0"  // 3010
+    "neighbours\0"  // 3011
+    "restore\0"  // 3012
+    "loyall\0"  // 3013
+    "swore\0"  // 3014
+    "sauage\0"  // 3015
+    "iot\0"  // 3016
+    "oddes\0"  // 3017
+    "loath\0"  // 3018
+    "interest\0"  // 3019
+    "aunt\0"  // 3020
+    "reduce\0"  // 3021
+    "greefes\0"  // 3022
+    "starre\0"  // 3023
+    "breast\0"  // 3024
+    "ioyn\0"  // 3025
+    "wot\0"  // 3026
+    "whither\0"  // 3027
+    "growing\0"  // 3028
+    "spleene\0"  // 3029
+    "guiltie\0"  // 3030
+    "alwayes\0"  // 3031
+    "ape\0"  // 3032
+    "william\0"  // 3033
+    "realme\0"  // 3034
+    "rode\0"  // 3035
+    "tearmes\0"  // 3036
+    "likes\0"  // 3037
+    "lesser\0"  // 3038
+    "walls\0"  // 3039
+    "lust\0"  // 3040
+    "star\0"  // 3041
+    "suites\0"  // 3042
+    "warn\0"  // 3043
+    "needes\0"  // 3044
+    "leauing\0"  // 3045
+    "bitterly\0"  // 3046
+    "ioyfull\0"  // 3047
+    "resolution\0"  // 3048
+    "bounds\0"  // 3049
+    "dire\0"  // 3050
+    "hoping\0"  // 3051
+    "appearing\0"  // 3052
+    "blind\0"  // 3053
+    "grand\0"  // 3054
+    "fearing\0"  // 3055
+    "serues\0"  // 3056
+    "bay\0"  // 3057
+    "imperiall\0"  // 3058
+    "paire\0"  // 3059
+    "dishonor\0"  // 3060
+    "wormes\0"  // 3061
+    "parents\0"  // 3062
+    "crew\0"  // 3063
+    "six\0"  // 3064
+    "fiery\0"  // 3065
+    "needfull\0"  // 3066
+    "larke\0"  // 3067
+    "executed\0"  // 3068
+    "ghosts\0"  // 3069
+    "shadowes\0"  // 3070
+    "soldiers\0"  // 3071
+    "rescue\0"  // 3072
+    "sixe\0"  // 3073
+    "compell\0"  // 3074
+    "agen\0"  // 3075
+    "cannon\0"  // 3076
+    "pound\0"  // 3077
+    "sticke\0"  // 3078
+    "riuer\0"  // 3079
+    "smoake\0"  // 3080
+    "horne\0"  // 3081
+    "windes\0"  // 3082
+    "correct\0"  // 3083
+    "superfluous\0"  // 3084
+    "defie\0"  // 3085
+    "hill\0"  // 3086
+    "malicious\0"  // 3087
+    "acts\0"  // 3088
+    "powres\0"  // 3089
+    "search\0"  // 3090
+    "richer\0"  // 3091
+    "maiesties\0"  // 3092
+    "repaire\0"  // 3093
+    "chosen\0"  // 3094
+    "raise\0"  // 3095
+    "likenesse\0"  // 3096
+    "swear\0"  // 3097
+    "loud\0"  // 3098
+    "pronounce\0"  // 3099
+    "alter\0"  // 3100
+    "despight\0"  // 3101
+    "walkes\0"  // 3102
+    "puts\0"  // 3103
+    "falconbridge\0"  // 3104
+    "vses\0"  // 3105
+    "dangers\0"  // 3106
+    "iewell\0"  // 3107
+    "borrow\0"  // 3108
+    "remoue\0"  // 3109
+    "presse\0"  // 3110
+    "condemned\0"  // 3111
+    "cozen\0"  // 3112
+    "carriages\0"  // 3113
+    "funerall\0"  // 3114
+    "sue\0"  // 3115
+    "teaching\0"  // 3116
+    "craft\0"  // 3117
+    "courtesie\0"  // 3118
+    "r\0"  // 3119
+    "drie\0"  // 3120
+    "message\0"  // 3121
+    "despised\0"  // 3122
+    "countrey\0"  // 3123
+    "searching\0"  // 3124
+    "girle\0"  // 3125
+    "amongst\0"  // 3126
+    "engage\0"  // 3127
+    "threw\0"  // 3128
+    "pace\0"  // 3129
+    "stage\0"  // 3130
+    "moy\0"  // 3131
+    "musick\0"  // 3132
+    "voyage\0"  // 3133
+    "bite\0"  // 3134
+    "pursued\0"  // 3135
+    "cozin\0"  // 3136
+    "mar\0"  // 3137
+    "honestly\0"  // 3138
+    "la\0"  // 3139
+    "reuels\0"  // 3140
+    "forehead\0"  // 3141
+    "ended\0"  // 3142
+    "schoole\0"  // 3143
+    "numbers\0"  // 3144
+    "thisbie\0"  // 3145
+    "ornament\0"  // 3146
+    "lodging\0"  // 3147
+    "nightly\0"  // 3148
+    "robin\0"  // 3149
+    "bush\0"  // 3150
+    "trace\0"  // 3151
+    "drowned\0"  // 3152
+    "questions\0"  // 3153
+    "dances\0"  // 3154
+    "apply\0"  // 3155
+    "defeated\0"  // 3156
+    "latter\0"  // 3157
+    "pounds\0"  // 3158
+    "working\0"  // 3159
+    "villany\0"  // 3160
+    "les\0"  // 3161
+    "arrant\0"  // 3162
+    "absolute\0"  // 3163
+    "saued\0"  // 3164
+    "monsieur\0"  // 3165
+    "petition\0"  // 3166
+    "antonio\0"  // 3167
+    "cinna\0"  // 3168
+    "lucillius\0"  // 3169
+    "philippi\0"  // 3170
+    "especially\0"  // 3171
+    "studied\0"  // 3172
+    "napkin\0"  // 3173
+    "fortinbras\0"  // 3174
+    "duties\0"  // 3175
+    "bethought\0"  // 3176
+    "vienna\0"  // 3177
+    "highest\0"  // 3178
+    "witty\0"  // 3179
+    "beneath\0"  // 3180
+    "instructed\0"  // 3181
+    "precise\0"  // 3182
+    "froth\0"  // 3183
+    "fearfull\0"  // 3184
+    "entertaine\0"  // 3185
+    "pleasures\0"  // 3186
+    "subtle\0"  // 3187
+    "armed\0"  // 3188
+    "shores\0"  // 3189
+    "nought\0"  // 3190
+    "heyre\0"  // 3191
+    "affraid\0"  // 3192
+    "curst\0"  // 3193
+    "diuels\0"  // 3194
+    "euils\0"  // 3195
+    "shoulders\0"  // 3196
+    "graunt\0"  // 3197
+    "reueng\0"  // 3198
+    "plantagenet\0"  // 3199
+    "shed\0"  // 3200
+    "fals\0"  // 3201
+    "ioyes\0"  // 3202
+    "maintaine\0"  // 3203
+    "concluded\0"  // 3204
+    "visiting\0"  // 3205
+    "imprison\0"  // 3206
+    "iniurie\0"  // 3207
+    "falsely\0"  // 3208
+    "suppose\0"  // 3209
+    "depos\0"  // 3210
+    "quake\0"  // 3211
+    "butcher\0"  // 3212
+    "befall\0"  // 3213
+    "frank\0"  // 3214
+    "aduis\0"  // 3215
+    "sirs\0"  // 3216
+    "secrets\0"  // 3217
+    "signifie\0"  // 3218
+    "goodnesse\0"  // 3219
+    "bowels\0"  // 3220
+    "desperately\0"  // 3221
+    "confound\0"  // 3222
+    "enmity\0"  // 3223
+    "friendly\0"  // 3224
+    "dyed\0"  // 3225
+    "lately\0"  // 3226
+    "beholding\0"  // 3227
+    "waile\0"  // 3228
+    "obedient\0"  // 3229
+    "feeble\0"  // 3230
+    "bethinke\0"  // 3231
+    "knit\0"  // 3232
+    "haply\0"  // 3233
+    "swell\0"  // 3234
+    "storme\0"  // 3235
+    "apace\0"  // 3236
+    "remembred\0"  // 3237
+    "priuiledge\0"  // 3238
+    "conquest\0"  // 3239
+    "fares\0"  // 3240
+    "soundly\0"  // 3241
+    "instance\0"  // 3242
+    "chase\0"  // 3243
+    "marked\0"  // 3244
+    "rowse\0"  // 3245
+    "safetie\0"  // 3246
+    "adue\0"  // 3247
+    "reuerend\0"  // 3248
+    "dumbe\0"  // 3249
+    "zeale\0"  // 3250
+    "corruption\0"  // 3251
+    "stock\0"  // 3252
+    "anothers\0"  // 3253
+    "prize\0"  // 3254
+    "strip\0"  // 3255
+    "promised\0"  // 3256
+    "roses\0"  // 3257
+    "rotten\0"  // 3258
+    "sounds\0"  // 3259
+    "staid\0"  // 3260
+    "victory\0"  // 3261
+    "nayles\0"  // 3262
+    "beauteous\0"  // 3263
+    "petty\0"  // 3264
+    "kil\0"  // 3265
+    "mayest\0"  // 3266
+    "liuer\0"  // 3267
+    "hir\0"  // 3268
+    "points\0"  // 3269
+    "fields\0"  // 3270
+    "inke\0"  // 3271
+    "stir\0"  // 3272
+    "troubled\0"  // 3273
+    "crush\0"  // 3274
+    "countrymen\0"  // 3275
+    "equally\0"  // 3276
+    "awe\0"  // 3277
+    "shooes\0"  // 3278
+    "cap\0"  // 3279
+    "sirra\0"  // 3280
+    "claim\0"  // 3281
+    "pence\0"  // 3282
+    "sucke\0"  // 3283
+    "fits\0"  // 3284
+    "legge\0"  // 3285
+    "confident\0"  // 3286
+    "arriu\0"  // 3287
+    "strife\0"  // 3288
+    "humors\0"  // 3289
+    "churlish\0"  // 3290
+    "posterity\0"  // 3291
+    "maist\0"  // 3292
+    "remoued\0"  // 3293
+    "doubts\0"  // 3294
+    "preparation\0"  // 3295
+    "fixed\0"  // 3296
+    "speede\0"  // 3297
+    "protection\0"  // 3298
+    "crest\0"  // 3299
+    "alike\0"  // 3300
+    "awhile\0"  // 3301
+    "mountaines\0"  // 3302
+    "willingly\0"  // 3303
+    "stoope\0"  // 3304
+    "limbes\0"  // 3305
+    "pope\0"  // 3306
+    "ridiculous\0"  // 3307
+    "performed\0"  // 3308
+    "profound\0"  // 3309
+    "pull\0"  // 3310
+    "heat\0"  // 3311
+    "quench\0"  // 3312
+    "pour\0"  // 3313
+    "coz\0"  // 3314
+    "green\0"  // 3315
+    "solemne\0"  // 3316
+    "giu\0"  // 3317
+    "stuffe\0"  // 3318
+    "expresse\0"  // 3319
+    "wer\0"  // 3320
+    "bodie\0"  // 3321
+    "quickely\0"  // 3322
+    "dwelling\0"  // 3323
+    "qualitie\0"  // 3324
+    "sings\0"  // 3325
+    "seruices\0"  // 3326
+    "euermore\0"  // 3327
+    "setting\0"  // 3328
+    "marshall\0"  // 3329
+    "correction\0"  // 3330
+    "cosine\0"  // 3331
+    "prophane\0"  // 3332
+    "harmony\0"  // 3333
+    "winters\0"  // 3334
+    "added\0"  // 3335
+    "paradise\0"  // 3336
+    "meerely\0"  // 3337
+    "waies\0"  // 3338
+    "knowest\0"  // 3339
+    "eu\0"  // 3340
+    "bigge\0"  // 3341
+    "stories\0"  // 3342
+    "fourth\0"  // 3343
+    "arrest\0"  // 3344
+    "safely\0"  // 3345
+    "pit\0"  // 3346
+    "beguile\0"  // 3347
+    "streame\0"  // 3348
+    "gall\0"  // 3349
+    "mourning\0"  // 3350
+    "hoe\0"  // 3351
+    "weapons\0"  // 3352
+    "verona\0"  // 3353
+    "doue\0"  // 3354
+    "torch\0"  // 3355
+    "cupid\0"  // 3356
+    "nuptiall\0"  // 3357
+    "rapier\0"  // 3358
+    "strangers\0"  // 3359
+    "exchange\0"  // 3360
+    "single\0"  // 3361
+    "hony\0"  // 3362
+    "minds\0"  // 3363
+    "wary\0"  // 3364
+    "thinks\0"  // 3365
+    "villanous\0"  // 3366
+    "apprehend\0"  // 3367
+    "bottom\0"  // 3368
+    "frame\0"  // 3369
+    "hornes\0"  // 3370
+    "corporall\0"  // 3371
+    "history\0"  // 3372
+    "certainly\0"  // 3373
+    "fauours\0"  // 3374
+    "katherine\0"  // 3375
+    "lack\0"  // 3376
+    "dieu\0"  // 3377
+    "iaques\0"  // 3378
+    "ashamed\0"  // 3379
+    "sauce\0"  // 3380
+    "turke\0"  // 3381
+    "cicero\0"  // 3382
+    "metellus\0"  // 3383
+    "senate\0"  // 3384
+    "publius\0"  // 3385
+    "pindarus\0"  // 3386
+    "fuller\0"  // 3387
+    "animals\0"  // 3388
+    "wages\0"  // 3389
+    "caught\0"  // 3390
+    "fancie\0"  // 3391
+    "eaten\0"  // 3392
+    "fifty\0"  // 3393
+    "generous\0"  // 3394
+    "laying\0"  // 3395
+    "foul\0"  // 3396
+    "guildensterne\0"  // 3397
+    "picture\0"  // 3398
+    "pyrrhus\0"  // 3399
+    "don\0"  // 3400
+    "dirt\0"  // 3401
+    "illyria\0"  // 3402
+    "niece\0"  // 3403
+    "madona\0"  // 3404
+    "v\0"  // 3405
+    "propriety\0"  // 3406
+    "arrested\0"  // 3407
+    "discontent\0"  // 3408
+    "strut\0"  // 3409
+    "drunken\0"  // 3410
+    "queenes\0"  // 3411
+    "strooke\0"  // 3412
+    "performe\0"  // 3413
+    "prisoners\0"  // 3414
+    "greeuous\0"  // 3415
+    "arguments\0"  // 3416
+    "anne\0"  // 3417
+    "hated\0"  // 3418
+    "venom\0"  // 3419
+    "vgly\0"  // 3420
+    "bleed\0"  // 3421
+    "perfection\0"  // 3422
+    "margaret\0"  // 3423
+    "milde\0"  // 3424
+    "haunt\0"  // 3425
+    "rent\0"  // 3426
+    "shade\0"  // 3427
+    "storie\0"  // 3428
+    "fee\0"  // 3429
+    "diuers\0"  // 3430
+    "alreadie\0"  // 3431
+    "crept\0"  // 3432
+    "goodly\0"  // 3433
+    "slanders\0"  // 3434
+    "deceiue\0"  // 3435
+    "contented\0"  // 3436
+    "acquaint\0"  // 3437
+    "pittifull\0"  // 3438
+    "scarce\0"  // 3439
+    "peeces\0"  // 3440
+    "shining\0"  // 3441
+    "beames\0"  // 3442
+    "tooth\0"  // 3443
+    "stout\0"  // 3444
+    "tempted\0"  // 3445
+    "pearle\0"  // 3446
+    "striue\0"  // 3447
+    "renowned\0"  // 3448
+    "wak\0"  // 3449
+    "cares\0"  // 3450
+    "glousters\0"  // 3451
+    "diuided\0"  // 3452
+    "continue\0"  // 3453
+    "redeeme\0"  // 3454
+    "neerer\0"  // 3455
+    "suspition\0"  // 3456
+    "attendant\0"  // 3457
+    "feet\0"  // 3458
+    "oxford\0"  // 3459
+    "deerely\0"  // 3460
+    "weepes\0"  // 3461
+    "poste\0"  // 3462
+    "growth\0"  // 3463
+    "obiect\0"  // 3464
+    "summe\0"  // 3465
+    "beheld\0"  // 3466
+    "resigne\0"  // 3467
+    "perswade\0"  // 3468
+    "ages\0"  // 3469
+    "prouided\0"  // 3470
+    "affected\0"  // 3471
+    "hereford\0"  // 3472
+    "yeelded\0"  // 3473
+    "councell\0"  // 3474
+    "stirring\0"  // 3475
+    "sounded\0"  // 3476
+    "honorable\0"  // 3477
+    "dine\0"  // 3478
+    "middle\0"  // 3479
+    "intending\0"  // 3480
+    "proceeded\0"  // 3481
+    "eleuen\0"  // 3482
+    "discipline\0"  // 3483
+    "lower\0"  // 3484
+    "argues\0"  // 3485
+    "deuotion\0"  // 3486
+    "kingly\0"  // 3487
+    "yoake\0"  // 3488
+    "manie\0"  // 3489
+    "nice\0"  // 3490
+    "noone\0"  // 3491
+    "apart\0"  // 3492
+    "resolue\0"  // 3493
+    "considerate\0"  // 3494
+    "exploit\0"  // 3495
+    "creation\0"  // 3496
+    "britaine\0"  // 3497
+    "herald\0"  // 3498
+    "roare\0"  // 3499
+    "saints\0"  // 3500
+    "torture\0"  // 3501
+    "successe\0"  // 3502
+    "staine\0"  // 3503
+    "calles\0"  // 3504
+    "silent\0"  // 3505
+    "wronged\0"  // 3506
+    "proceeding\0"  // 3507
+    "sinke\0"  // 3508
+    "emptie\0"  // 3509
+    "rebels\0"  // 3510
+    "fraile\0"  // 3511
+    "moe\0"  // 3512
+    "waters\0"  // 3513
+    "isle\0"  // 3514
+    "quarter\0"  // 3515
+    "south\0"  // 3516
+    "rites\0"  // 3517
+    "spurre\0"  // 3518
+    "hazard\0"  // 3519
+    "deceased\0"  // 3520
+    "constance\0"  // 3521
+    "roberts\0"  // 3522
+    "grandame\0"  // 3523
+    "conspired\0"  // 3524
+    "lift\0"  // 3525
+    "lo\0"  // 3526
+    "siege\0"  // 3527
+    "authoritie\0"  // 3528
+    "checke\0"  // 3529
+    "parle\0"  // 3530
+    "beds\0"  // 3531
+    "euerlasting\0"  // 3532
+    "equall\0"  // 3533
+    "education\0"  // 3534
+    "charitie\0"  // 3535
+    "lamentable\0"  // 3536
+    "recreant\0"  // 3537
+    "limbs\0"  // 3538
+    "listen\0"  // 3539
+    "rebellion\0"  // 3540
+    "sexton\0"  // 3541
+    "mischiefe\0"  // 3542
+    "imprisoned\0"  // 3543
+    "merriment\0"  // 3544
+    "binde\0"  // 3545
+    "youthfull\0"  // 3546
+    "warme\0"  // 3547
+    "distemper\0"  // 3548
+    "dozen\0"  // 3549
+    "mountaine\0"  // 3550
+    "lambe\0"  // 3551
+    "nimble\0"  // 3552
+    "leape\0"  // 3553
+    "thred\0"  // 3554
+    "maker\0"  // 3555
+    "wrastling\0"  // 3556
+    "chambers\0"  // 3557
+    "pangs\0"  // 3558
+    "soldier\0"  // 3559
+    "peraduenture\0"  // 3560
+    "orchard\0"  // 3561
+    "appeale\0"  // 3562
+    "cloudes\0"  // 3563
+    "twaine\0"  // 3564
+    "engaged\0"  // 3565
+    "pilgrimage\0"  // 3566
+    "pricke\0"  // 3567
+    "commons\0"  // 3568
+    "rightly\0"  // 3569
+    "wanting\0"  // 3570
+    "discouer\0"  // 3571
+    "indifferent\0"  // 3572
+    "adder\0"  // 3573
+    "vnhappie\0"  // 3574
+    "bores\0"  // 3575
+    "elements\0"  // 3576
+    "offences\0"  // 3577
+    "frequent\0"  // 3578
+    "ioynt\0"  // 3579
+    "quarrel\0"  // 3580
+    "whipt\0"  // 3581
+    "knock\0"  // 3582
+    "courtiers\0"  // 3583
+    "follows\0"  // 3584
+    "clock\0"  // 3585
+    "wild\0"  // 3586
+    "ifaith\0"  // 3587
+    "doublet\0"  // 3588
+    "couple\0"  // 3589
+    "cat\0"  // 3590
+    "price\0"  // 3591
+    "monument\0"  // 3592
+    "sharp\0"  // 3593
+    "cleare\0"  // 3594
+    "punished\0"  // 3595
+    "theseus\0"  // 3596
+    "fancies\0"  // 3597
+    "darkness\0"  // 3598
+    "actors\0"  // 3599
+    "pyramus\0"  // 3600
+    "terribly\0"  // 3601
+    "whistling\0"  // 3602
+    "mud\0"  // 3603
+    "chaste\0"  // 3604
+    "forest\0"  // 3605
+    "geese\0"  // 3606
+    "hounds\0"  // 3607
+    "function\0"  // 3608
+    "fortunate\0"  // 3609
+    "weak\0"  // 3610
+    "imperfection\0"  // 3611
+    "flew\0"  // 3612
+    "ceremonie\0"  // 3613
+    "handed\0"  // 3614
+    "adam\0"  // 3615
+    "tenth\0"  // 3616
+    "spouse\0"  // 3617
+    "sufferance\0"  // 3618
+    "gull\0"  // 3619
+    "fleet\0"  // 3620
+    "amount\0"  // 3621
+    "vostre\0"  // 3622
+    "thames\0"  // 3623
+    "peacocks\0"  // 3624
+    "pleases\0"  // 3625
+    "deep\0"  // 3626
+    "withal\0"  // 3627
+    "climb\0"  // 3628
+    "games\0"  // 3629
+    "senators\0"  // 3630
+    "cymber\0"  // 3631
+    "decius\0"  // 3632
+    "suffers\0"  // 3633
+    "portia\0"  // 3634
+    "vanished\0"  // 3635
+    "waited\0"  // 3636
+    "ninth\0"  // 3637
+    "ate\0"  // 3638
+    "regarded\0"  // 3639
+    "inherited\0"  // 3640
+    "abandoned\0"  // 3641
+    "clowne\0"  // 3642
+    "inuention\0"  // 3643
+    "motley\0"  // 3644
+    "particulars\0"  // 3645
+    "tapster\0"  // 3646
+    "customary\0"  // 3647
+    "select\0"  // 3648
+    "lone\0"  // 3649
+    "regards\0"  // 3650
+    "affectation\0"  // 3651
+    "mining\0"  // 3652
+    "dishes\0"  // 3653
+    "chapter\0"  // 3654
+    "earn\0"  // 3655
+    "stores\0"  // 3656
+    "dedication\0"  // 3657
+    "prepared\0"  // 3658
+    "custom\0"  // 3659
+    "authority\0"  // 3660
+    "varlet\0"  // 3661
+    "robbery\0"  // 3662
+    "sliding\0"  // 3663
+    "require\0"  // 3664
+    "mariana\0"  // 3665
+    "pretending\0"  // 3666
+    "bachelor\0"  // 3667
+    "offender\0"  // 3668
+    "drunk\0"  // 3669
+    "impudence\0"  // 3670
+    "spied\0"  // 3671
+    "habits\0"  // 3672
+    "industry\0"  // 3673
+    "difficulty\0"  // 3674
+    "mask\0"  // 3675
+    "front\0"  // 3676
+    "dogges\0"  // 3677
+    "secretly\0"  // 3678
+    "imploy\0"  // 3679
+    "path\0"  // 3680
+    "amends\0"  // 3681
+    "aduance\0"  // 3682
+    "spurne\0"  // 3683
+    "heynous\0"  // 3684
+    "heau\0"  // 3685
+    "currant\0"  // 3686
+    "executioner\0"  // 3687
+    "childish\0"  // 3688
+    "wept\0"  // 3689
+    "kissing\0"  // 3690
+    "yon\0"  // 3691
+    "determin\0"  // 3692
+    "derby\0"  // 3693
+    "complaints\0"  // 3694
+    "enuy\0"  // 3695
+    "handsome\0"  // 3696
+    "threat\0"  // 3697
+    "iesu\0"  // 3698
+    "scornes\0"  // 3699
+    "quick\0"  // 3700
+    "howres\0"  // 3701
+    "indignation\0"  // 3702
+    "outrage\0"  // 3703
+    "odde\0"  // 3704
+    "periur\0"  // 3705
+    "seize\0"  // 3706
+    "torment\0"  // 3707
+    "fiends\0"  // 3708
+    "impression\0"  // 3709
+    "commanded\0"  // 3710
+    "hates\0"  // 3711
+    "falshood\0"  // 3712
+    "tardie\0"  // 3713
+    "lap\0"  // 3714
+    "babes\0"  // 3715
+    "plant\0"  // 3716
+    "forthwith\0"  // 3717
+    "apparant\0"  // 3718
+    "enrich\0"  // 3719
+    "weeds\0"  // 3720
+    "ceremonious\0"  // 3721
+    "cæsar\0"  // 3722
+    "record\0"  // 3723
+    "toy\0"  // 3724
+    "summon\0"  // 3725
+    "mis\0"  // 3726
+    "ayme\0"  // 3727
+    "witchcraft\0"  // 3728
+    "longs\0"  // 3729
+    "straw\0"  // 3730
+    "auoid\0"  // 3731
+    "fryer\0"  // 3732
+    "trifles\0"  // 3733
+    "assembled\0"  // 3734
+    "religious\0"  // 3735
+    "ancestors\0"  // 3736
+    "stealing\0"  // 3737
+    "salute\0"  // 3738
+    "grossely\0"  // 3739
+    "tend\0"  // 3740
+    "token\0"  // 3741
+    "processe\0"  // 3742
+    "hop\0"  // 3743
+    "sodainly\0"  // 3744
+    "bending\0"  // 3745
+    "rate\0"  // 3746
+    "confirm\0"  // 3747
+    "ordinance\0"  // 3748
+    "perish\0"  // 3749
+    "spoyle\0"  // 3750
+    "forbids\0"  // 3751
+    "strings\0"  // 3752
+    "affayres\0"  // 3753
+    "doubtfull\0"  // 3754
+    "flocke\0"  // 3755
+    "landed\0"  // 3756
+    "falles\0"  // 3757
+    "surrey\0"  // 3758
+    "vtmost\0"  // 3759
+    "slumber\0"  // 3760
+    "substance\0"  // 3761
+    "sweetest\0"  // 3762
+    "fairest\0"  // 3763
+    "drowsie\0"  // 3764
+    "chaire\0"  // 3765
+    "ward\0"  // 3766
+    "boldly\0"  // 3767
+    "milke\0"  // 3768
+    "beggers\0"  // 3769
+    "abate\0"  // 3770
+    "edge\0"  // 3771
+    "streames\0"  // 3772
+    "behauiour\0"  // 3773
+    "embassie\0"  // 3774
+    "defiance\0"  // 3775
+    "produce\0"  // 3776
+    "faulconbridge\0"  // 3777
+    "yonger\0"  // 3778
+    "fourteene\0"  // 3779
+    "betters\0"  // 3780
+    "henceforth\0"  // 3781
+    "stomacke\0"  // 3782
+    "tribute\0"  // 3783
+    "furie\0"  // 3784
+    "rob\0"  // 3785
+    "taske\0"  // 3786
+    "permit\0"  // 3787
+    "sweat\0"  // 3788
+    "hare\0"  // 3789
+    "vppon\0"  // 3790
+    "messengers\0"  // 3791
+    "disturb\0"  // 3792
+    "locke\0"  // 3793
+    "policie\0"  // 3794
+    "drift\0"  // 3795
+    "ope\0"  // 3796
+    "coole\0"  // 3797
+    "wondrous\0"  // 3798
+    "addition\0"  // 3799
+    "satisfie\0"  // 3800
+    "clap\0"  // 3801
+    "oppression\0"  // 3802
+    "slight\0"  // 3803
+    "difference\0"  // 3804
+    "paint\0"  // 3805
+    "hoast\0"  // 3806
+    "sweares\0"  // 3807
+    "nobler\0"  // 3808
+    "motiue\0"  // 3809
+    "driue\0"  // 3810
+    "straine\0"  // 3811
+    "fellowship\0"  // 3812
+    "balls\0"  // 3813
+    "vtter\0"  // 3814
+    "philosophy\0"  // 3815
+    "bonds\0"  // 3816
+    "aloud\0"  // 3817
+    "breeds\0"  // 3818
+    "restraint\0"  // 3819
+    "feete\0"  // 3820
+    "rank\0"  // 3821
+    "slaues\0"  // 3822
+    "confine\0"  // 3823
+    "spots\0"  // 3824
+    "comment\0"  // 3825
+    "cloake\0"  // 3826
+    "spectacle\0"  // 3827
+    "rt\0"  // 3828
+    "cord\0"  // 3829
+    "center\0"  // 3830
+    "swearing\0"  // 3831
+    "amazement\0"  // 3832
+    "horror\0"  // 3833
+    "displeasure\0"  // 3834
+    "lowd\0"  // 3835
+    "flight\0"  // 3836
+    "quinta\0"  // 3837
+    "scape\0"  // 3838
+    "sans\0"  // 3839
+    "inuisible\0"  // 3840
+    "afternoone\0"  // 3841
+    "eager\0"  // 3842
+    "stooping\0"  // 3843
+    "fold\0"  // 3844
+    "wander\0"  // 3845
+    "courtship\0"  // 3846
+    "wholsome\0"  // 3847
+    "watching\0"  // 3848
+    "bands\0"  // 3849
+    "support\0"  // 3850
+    "lawes\0"  // 3851
+    "vnseene\0"  // 3852
+    "sting\0"  // 3853
+    "grasse\0"  // 3854
+    "gay\0"  // 3855
+    "drest\0"  // 3856
+    "belong\0"  // 3857
+    "scull\0"  // 3858
+    "procure\0"  // 3859
+    "forsweare\0"  // 3860
+    "statutes\0"  // 3861
+    "morall\0"  // 3862
+    "actor\0"  // 3863
+    "contents\0"  // 3864
+    "violets\0"  // 3865
+    "intended\0"  // 3866
+    "created\0"  // 3867
+    "heerein\0"  // 3868
+    "tibalt\0"  // 3869
+    "fray\0"  // 3870
+    "feather\0"  // 3871
+    "agree\0"  // 3872
+    "seigneur\0"  // 3873
+    "inough\0"  // 3874
+    "cur\0"  // 3875
+    "inconstant\0"  // 3876
+    "dropping\0"  // 3877
+    "madman\0"  // 3878
+    "vertues\0"  // 3879
+    "medicine\0"  // 3880
+    "flies\0"  // 3881
+    "stretch\0"  // 3882
+    "desir\0"  // 3883
+    "publike\0"  // 3884
+    "scratch\0"  // 3885
+    "surgeon\0"  // 3886
+    "gon\0"  // 3887
+    "sober\0"  // 3888
+    "eloquence\0"  // 3889
+    "conceal\0"  // 3890
+    "drinkes\0"  // 3891
+    "ladyship\0"  // 3892
+    "masse\0"  // 3893
+    "instruments\0"  // 3894
+    "cakes\0"  // 3895
+    "afraid\0"  // 3896
+    "lanthorne\0"  // 3897
+    "fantasie\0"  // 3898
+    "rings\0"  // 3899
+    "virgin\0"  // 3900
+    "leagues\0"  // 3901
+    "obseruance\0"  // 3902
+    "quince\0"  // 3903
+    "fates\0"  // 3904
+    "thisbies\0"  // 3905
+    "oberon\0"  // 3906
+    "maidens\0"  // 3907
+    "sate\0"  // 3908
+    "gentlenesse\0"  // 3909
+    "trip\0"  // 3910
+    "recount\0"  // 3911
+    "beards\0"  // 3912
+    "salike\0"  // 3913
+    "vnderstanding\0"  // 3914
+    "sheets\0"  // 3915
+    "losses\0"  // 3916
+    "harflew\0"  // 3917
+    "blast\0"  // 3918
+    "filthy\0"  // 3919
+    "est\0"  // 3920
+    "bar\0"  // 3921
+    "estimation\0"  // 3922
+    "gets\0"  // 3923
+    "praised\0"  // 3924
+    "dat\0"  // 3925
+    "fraunce\0"  // 3926
+    "liued\0"  // 3927
+    "calphurnia\0"  // 3928
+    "property\0"  // 3929
+    "constantly\0"  // 3930
+    "anie\0"  // 3931
+    "counsel\0"  // 3932
+    "ganimed\0"  // 3933
+    "extent\0"  // 3934
+    "pastime\0"  // 3935
+    "dane\0"  // 3936
+    "assay\0"  // 3937
+    "pregnant\0"  // 3938
+    "chances\0"  // 3939
+    "sebastian\0"  // 3940
+    "notable\0"  // 3941
+    "affect\0"  // 3942
+    "anthonio\0"  // 3943
+    "escalus\0"  // 3944
+    "general\0"  // 3945
+    "brabantio\0"  // 3946
+    "michael\0"  // 3947
+    "bianca\0"  // 3948
+    "seacoal\0"  // 3949
+    "knave\0"  // 3950
+    "subjects\0"  // 3951
+    "calf\0"  // 3952
+    "borachio\0"  // 3953
+    "conrade\0"  // 3954
+    "gives\0"  // 3955
+    "gaol\0"  // 3956
+    "writer\0"  // 3957
+    "iv\0"  // 3958
+    "inside\0"  // 3959
+    "reformed\0"  // 3960
+    "deformed\0"  // 3961
+    "plummage\0"  // 3962
+    "peacock\0"  // 3963
+    "elaboration\0"  // 3964
+    "flock\0"  // 3965
+    "deserted\0"  // 3966
+    "peaceful\0"  // 3967
+    "powerful\0"  // 3968
+    "storm\0"  // 3969
+    "wrapped\0"  // 3970
+    "tighter\0"  // 3971
+    "avail\0"  // 3972
+    "exhausted\0"  // 3973
+    "brighter\0"  // 3974
+    "overcome\0"  // 3975
+    "manger\0"  // 3976
+    "sank\0"  // 3977
+    "loss\0"  // 3978
+    "divine\0"  // 3979
+    "plain\0"  // 3980
+    "worn\0"  // 3981
+    "snatched\0"  // 3982
+    "greedily\0"  // 3983
+    "truthful\0"  // 3984
+    "invited\0"  // 3985
+    "satisfactory\0"  // 3986
+    "contemptibly\0"  // 3987
+    "enjoy\0"  // 3988
+    "pretend\0"  // 3989
+    "starved\0"  // 3990
+    "labored\0"  // 3991
+    "music\0"  // 3992
+    "desartlessly\0"  // 3993
+    "useful\0"  // 3994
+    "frightened\0"  // 3995
+    "pitiable\0"  // 3996
+    "aware\0"  // 3997
+    "generously\0"  // 3998
+    "gratitude";  // 3999
+
+// Start of each word in VOCAB_POOL, plus the end of the pool
+const vocab_offset_t VOCAB_OFFSETS[VOCAB_COUNT + 1] PROGMEM = {
+    0, 6, 12, 20, 22, 26, 30, 33, 36, 38, 40, 42, 44, 47, 52, 56,
+    59, 62, 64, 68, 72, 75, 80, 82, 85, 89, 92, 97, 101, 104, 107, 109,
+    114, 119, 123, 126, 131, 136, 141, 146, 150, 154, 157, 161, 163, 166, 170, 173,
+    177, 179, 185, 190, 193, 197, 202, 205, 210, 213, 217, 223, 228, 233, 236, 239,
+    243, 247, 253, 257, 262, 267, 271, 276, 282, 286, 290, 295, 301, 306, 311, 315,
+    320, 327, 330, 333, 337, 341, 345, 349, 353, 355, 360, 365, 370, 375, 380, 385,
+    391, 396, 402, 407, 411, 416, 421, 425, 428, 434, 438, 442, 448, 451, 455, 462,
+    467, 473, 477, 481, 485, 490, 494, 500, 503, 507, 512, 518, 522, 527, 533, 538,
+    541, 545, 549, 554, 559, 564, 567, 571, 578, 585, 590, 595, 602, 604, 609, 614,
+    619, 626, 632, 637, 641, 648, 653, 658, 665, 671, 676, 683, 689, 695, 702, 708,
+    713, 720, 726, 731, 739, 747, 753, 758, 764, 769, 772, 779, 785, 790, 796, 802,
+    808, 813, 823, 829, 833, 838, 845, 851, 857, 865, 873, 877, 882, 887, 894, 900,
+    906, 910, 915, 920, 925, 929, 934, 940, 944, 950, 955, 961, 966, 972, 977, 982,
+    988, 994, 1000, 1006, 1010, 1016, 1021, 1025, 1030, 1036, 1041, 1046, 1052, 1058, 1063, 1069,
+    1075, 1081, 1085, 1089, 1094, 1102, 1107, 1112, 1120, 1126, 1134, 1141, 1154, 1159, 1165, 1170,
+    1177, 1183, 1190, 1195, 1200, 1204, 1209, 1216, 1223, 1231, 1236, 1240, 1247, 1256, 1261, 1267,
+    1274, 1281, 1287, 1292, 1297, 1303, 1311, 1319, 1325, 1332, 1337, 1341, 1347, 1352, 1357, 1361,
+    1367, 1373, 1383, 1387, 1394, 1401, 1410, 1417, 1423, 1428, 1433, 1438, 1446, 1455, 1462, 1466,
+    1471, 1475, 1480, 1486, 1493, 1500, 1506, 1512, 1515, 1520, 1524, 1531, 1535, 1542, 1549, 1555,
+    1561, 1567, 1574, 1580, 1588, 1593, 1599, 1605, 1611, 1620, 1625, 1631, 1641, 1646, 1652, 1657,
+    1663, 1671, 1675, 1683, 1687, 1690, 1696, 1701, 1705, 1711, 1717, 1723, 1729, 1734, 1740, 1747,
+    1751, 1758, 1764, 1771, 1776, 1784, 1791, 1796, 1802, 1807, 1812, 1818, 1824, 1831, 1838, 1844,
+    1849, 1854, 1859, 1864, 1873, 1877, 1881, 1885, 1892, 1898, 1905, 1910, 1916, 1918, 1922, 1932,
+    1942, 1946, 1952, 1958, 1964, 1971, 1976, 1983, 1989, 1993, 1997, 2007, 2013, 2019, 2022, 2027,
+    2035, 2040, 2043, 2048, 2054, 2056, 2063, 2068, 2076, 2082, 2089, 2094, 2098, 2102, 2107, 2112,
+    2119, 2127, 2136, 2144, 2149, 2155, 2163, 2169, 2175, 2182, 2187, 2196, 2201, 2207, 2212, 2218,
+    2222, 2229, 2237, 2248, 2253, 2263, 2267, 2272, 2281, 2287, 2294, 2300, 2305, 2308, 2315, 2320,
+    2327, 2331, 2337, 2345, 2349, 2355, 2361, 2369, 2377, 2384, 2389, 2394, 2403, 2406, 2418, 2426,
+    2430, 2435, 2443, 2452, 2459, 2464, 2470, 2475, 2481, 2488, 2494, 2499, 2505, 2510, 2517, 2521,
+    2529, 2531, 2537, 2543, 2549, 2558, 2564, 2569, 2575, 2582, 2589, 2594, 2599, 2607, 2615, 2622,
+    2628, 2635, 2641, 2648, 2658, 2663, 2670, 2678, 2685, 2692, 2698, 2704, 2710, 2714, 2719, 2725,
+    2731, 2741, 2748, 2755, 2761, 2767, 2772, 2778, 2787, 2792, 2798, 2807, 2813, 2819, 2825, 2833,
+    2840, 2846, 2850, 2859, 2865, 2872, 2879, 2884, 2890, 2895, 2900, 2906, 2911, 2916, 2922, 2928,
+    2936, 2942, 2947, 2952, 2958, 2965, 2973, 2980, 2984, 2988, 2995, 3002, 3008, 3016, 3024, 3032,
+    3037, 3045, 3051, 3056, 3062, 3066, 3075, 3082, 3089, 3093, 3097, 3101, 3107, 3112, 3118, 3123,
+    3129, 3135, 3140, 3147, 3157, 3162, 3171, 3176, 3180, 3191, 3202, 3210, 3216, 3223, 3228, 3233,
+    3240, 3246, 3253, 3257, 3261, 3267, 3276, 3281, 3288, 3298, 3304, 3311, 3316, 3322, 3329, 3334,
+    3341, 3346, 3351, 3355, 3361, 3365, 3369, 3376, 3382, 3388, 3391, 3396, 3402, 3406, 3408, 3416,
+    3425, 3431, 3439, 3448, 3453, 3459, 3471, 3478, 3483, 3491, 3499, 3503, 3509, 3519, 3525, 3531,
+    3540, 3548, 3552, 3560, 3568, 3575, 3580, 3587, 3592, 3598, 3605, 3612, 3617, 3623, 3632, 3638,
+    3645, 3651, 3657, 3666, 3675, 3680, 3687, 3693, 3699, 3703, 3709, 3716, 3724, 3730, 3734, 3739,
+    3744, 3749, 3758, 3767, 3772, 3778, 3783, 3790, 3796, 3804, 3812, 3818, 3823, 3828, 3832, 3840,
+    3847, 3854, 3863, 3870, 3876, 3883, 3888, 3893, 3901, 3907, 3913, 3920, 3929, 3935, 3940, 3945,
+    3957, 3962, 3970, 3977, 3982, 3988, 3995, 4001, 4007, 4012, 4018, 4026, 4032, 4037, 4048, 4056,
+    4063, 4074, 4080, 4086, 4093, 4096, 4102, 4109, 4114, 4120, 4126, 4134, 4144, 4148, 4154, 4158,
+    4163, 4170, 4177, 4181, 4186, 4193, 4201, 4208, 4213, 4221, 4225, 4230, 4240, 4245, 4252, 4261,
+    4269, 4276, 4282, 4290, 4297, 4303, 4307, 4318, 4326, 4334, 4339, 4344, 4350, 4355, 4361, 4368,
+    4374, 4385, 4395, 4402, 4406, 4416, 4427, 4436, 4442, 4446, 4454, 4462, 4468, 4475, 4481, 4487,
+    4491, 4498, 4506, 4511, 4517, 4524, 4531, 4537, 4545, 4555, 4562, 4567, 4573, 4581, 4588, 4595,
+    4602, 4609, 4616, 4621, 4632, 4640, 4646, 4649, 4655, 4660, 4668, 4673, 4678, 4683, 4692, 4701,
+    4712, 4718, 4724, 4730, 4737, 4744, 4750, 4757, 4762, 4770, 4775, 4780, 4786, 4794, 4801, 4811,
+    4817, 4823, 4826, 4834, 4840, 4845, 4854, 4862, 4871, 4879, 4887, 4891, 4900, 4908, 4914, 4929,
+    4943, 4954, 4963, 4970, 4979, 4986, 4997, 5003, 5009, 5015, 5020, 5027, 5033, 5038, 5043, 5048,
+    5055, 5061, 5069, 5073, 5078, 5085, 5092, 5098, 5105, 5113, 5119, 5127, 5132, 5137, 5144, 5150,
+    5155, 5162, 5171, 5179, 5186, 5194, 5200, 5209, 5214, 5220, 5228, 5235, 5244, 5253, 5261, 5268,
+    5276, 5282, 5288, 5296, 5303, 5309, 5315, 5322, 5328, 5332, 5340, 5347, 5353, 5358, 5363, 5370,
+    5377, 5387, 5391, 5399, 5407, 5415, 5420, 5428, 5435, 5440, 5446, 5456, 5462, 5472, 5478, 5484,
+    5489, 5495, 5503, 5508, 5513, 5519, 5525, 5533, 5545, 5551, 5557, 5563, 5569, 5574, 5580, 5588,
+    5594, 5601, 5609, 5618, 5624, 5631, 5638, 5644, 5652, 5657, 5666, 5673, 5683, 5690, 5698, 5705,
+    5711, 5722, 5729, 5735, 5740, 5746, 5753, 5757, 5764, 5773, 5779, 5783, 5797, 5803, 5811, 5818,
+    5823, 5828, 5835, 5847, 5853, 5859, 5866, 5871, 5877, 5882, 5887, 5895, 5902, 5912, 5919, 5924,
+    5930, 5936, 5945, 5951, 5959, 5965, 5976, 5984, 5990, 5997, 6004, 6009, 6016, 6022, 6030, 6035,
+    6042, 6047, 6052, 6057, 6064, 6069, 6075, 6084, 6091, 6098, 6105, 6111, 6116, 6124, 6131, 6139,
+    6145, 6154, 6160, 6164, 6169, 6174, 6181, 6189, 6194, 6203, 6211, 6216, 6221, 6228, 6235, 6240,
+    6246, 6252, 6260, 6267, 6272, 6279, 6285, 6295, 6301, 6307, 6318, 6325, 6333, 6340, 6349, 6355,
+    6363, 6373, 6380, 6390, 6397, 6405, 6412, 6416, 6424, 6430, 6439, 6442, 6453, 6458, 6467, 6474,
+    6480, 6486, 6491, 6493, 6501, 6508, 6515, 6525, 6532, 6539, 6545, 6553, 6557, 6563, 6569, 6583,
+    6589, 6595, 6603, 6612, 6617, 6625, 6635, 6643, 6648, 6655, 6662, 6671, 6680, 6687, 6692, 6698,
+    6704, 6714, 6720, 6723, 6729, 6738, 6744, 6752, 6757, 6763, 6769, 6777, 6783, 6790, 6796, 6800,
+    6805, 6811, 6817, 6825, 6831, 6842, 6848, 6856, 6863, 6869, 6877, 6883, 6888, 6896, 6901, 6909,
+    6913, 6918, 6925, 6931, 6938, 6944, 6949, 6955, 6962, 6967, 6973, 6985, 6990, 6997, 7003, 7008,
+    7012, 7017, 7024, 7030, 7035, 7041, 7046, 7051, 7056, 7062, 7070, 7079, 7085, 7090, 7095, 7101,
+    7108, 7114, 7123, 7129, 7136, 7145, 7151, 7159, 7164, 7170, 7181, 7186, 7196, 7203, 7210, 7217,
+    7222, 7229, 7235, 7244, 7252, 7264, 7271, 7279, 7287, 7293, 7298, 7303, 7313, 7317, 7323, 7328,
+    7334, 7342, 7352, 7354, 7360, 7367, 7373, 7380, 7385, 7393, 7401, 7408, 7414, 7422, 7428, 7432,
+    7436, 7441, 7448, 7454, 7459, 7464, 7470, 7475, 7481, 7487, 7492, 7497, 7505, 7514, 7526, 7539,
+    7549, 7554, 7564, 7572, 7578, 7585, 7591, 7598, 7606, 7615, 7623, 7630, 7636, 7646, 7650, 7655,
+    7660, 7668, 7675, 7682, 7691, 7698, 7704, 7712, 7722, 7728, 7735, 7742, 7746, 7752, 7760, 7767,
+    7772, 7779, 7784, 7790, 7797, 7808, 7822, 7830, 7838, 7846, 7855, 7862, 7870, 7879, 7885, 7891,
+    7896, 7902, 7911, 7916, 7923, 7929, 7938, 7945, 7952, 7958, 7966, 7971, 7977, 7983, 7991, 7998,
+    8006, 8014, 8019, 8026, 8034, 8042, 8048, 8057, 8063, 8071, 8080, 8088, 8093, 8099, 8109, 8114,
+    8123, 8130, 8139, 8145, 8156, 8165, 8173, 8180, 8188, 8194, 8201, 8207, 8213, 8218, 8223, 8230,
+    8237, 8243, 8249, 8256, 8263, 8268, 8278, 8283, 8290, 8296, 8301, 8306, 8311, 8319, 8324, 8333,
+    8342, 8350, 8359, 8366, 8377, 8383, 8390, 8398, 8404, 8407, 8417, 8423, 8429, 8436, 8441, 8448,
+    8454, 8461, 8466, 8475, 8482, 8491, 8498, 8508, 8512, 8525, 8531, 8540, 8547, 8553, 8560, 8570,
+    8580, 8586, 8595, 8602, 8611, 8616, 8625, 8631, 8637, 8642, 8646, 8652, 8659, 8670, 8677, 8682,
+    8690, 8699, 8710, 8718, 8723, 8731, 8738, 8749, 8754, 8764, 8770, 8776, 8782, 8786, 8793, 8797,
+    8806, 8813, 8820, 8827, 8833, 8839, 8845, 8852, 8860, 8865, 8873, 8880, 8886, 8893, 8900, 8906,
+    8913, 8919, 8925, 8933, 8938, 8947, 8951, 8958, 8965, 8979, 8987, 8994, 9001, 9007, 9013, 9020,
+    9029, 9035, 9044, 9052, 9060, 9066, 9074, 9081, 9087, 9096, 9103, 9109, 9116, 9123, 9130, 9137,
+    9143, 9149, 9158, 9164, 9173, 9180, 9186, 9193, 9199, 9208, 9221, 9227, 9229, 9240, 9247, 9255,
+    9260, 9267, 9274, 9283, 9293, 9300, 9306, 9315, 9324, 9331, 9337, 9343, 9352, 9360, 9366, 9371,
+    9381, 9386, 9395, 9403, 9411, 9418, 9425, 9432, 9443, 9453, 9459, 9464, 9472, 9485, 9492, 9501,
+    9508, 9516, 9523, 9531, 9536, 9542, 9549, 9555, 9563, 9573, 9578, 9585, 9595, 9605, 9608, 9614,
+    9622, 9628, 9636, 9643, 9648, 9655, 9662, 9670, 9677, 9683, 9689, 9696, 9702, 9707, 9712, 9719,
+    9726, 9733, 9738, 9744, 9749, 9756, 9764, 9774, 9780, 9787, 9796, 9803, 9810, 9816, 9822, 9827,
+    9833, 9840, 9847, 9853, 9861, 9868, 9874, 9879, 9886, 9891, 9898, 9906, 9911, 9916, 9923, 9932,
+    9941, 9951, 9959, 9966, 9974, 9978, 9989, 10002, 10011, 10025, 10031, 10038, 10046, 10055, 10062, 10072,
+    10084, 10088, 10094, 10103, 10117, 10126, 10137, 10143, 10152, 10162, 10168, 10177, 10179, 10188, 10196, 10203,
+    10210, 10217, 10224, 10232, 10237, 10241, 10247, 10255, 10264, 10272, 10281, 10289, 10296, 10302, 10313, 10319,
+    10328, 10335, 10340, 10347, 10354, 10361, 10369, 10376, 10381, 10386, 10395, 10406, 10413, 10417, 10422, 10430,
+    10436, 10445, 10451, 10457, 10462, 10468, 10474, 10477, 10482, 10488, 10497, 10507, 10514, 10523, 10527, 10533,
+    10539, 10546, 10550, 10555, 10561, 10567, 10574, 10581, 10588, 10596, 10605, 10612, 10619, 10627, 10631, 10635,
+    10639, 10645, 10651, 10657, 10670, 10676, 10682, 10689, 10693, 10698, 10706, 10716, 10723, 10734, 10742, 10747,
+    10755, 10762, 10769, 10773, 10780, 10786, 10794, 10806, 10813, 10821, 10827, 10834, 10839, 10847, 10856, 10861,
+    10868, 10874, 10885, 10895, 10903, 10910, 10917, 10927, 10937, 10948, 10954, 10960, 10970, 10979, 10987, 10994,
+    11002, 11010, 11017, 11025, 11031, 11038, 11046, 11053, 11063, 11068, 11074, 11083, 11091, 11099, 11105, 11111,
+    11117, 11132, 11136, 11142, 11151, 11157, 11162, 11168, 11173, 11181, 11187, 11192, 11200, 11206, 11211, 11218,
+    11228, 11235, 11243, 11251, 11257, 11267, 11272, 11278, 11288, 11294, 11298, 11302, 11307, 11318, 11326, 11333,
+    11339, 11346, 11354, 11359, 11365, 11371, 11376, 11384, 11390, 11396, 11405, 11415, 11420, 11433, 11442, 11449,
+    11456, 11465, 11472, 11483, 11490, 11497, 11505, 11518, 11523, 11528, 11537, 11545, 11552, 11559, 11566, 11573,
+    11580, 11584, 11591, 11599, 11606, 11612, 11619, 11630, 11638, 11646, 11650, 11655, 11661, 11666, 11674, 11680,
+    11686, 11693, 11702, 11706, 11712, 11719, 11726, 11732, 11741, 11750, 11757, 11762, 11773, 11781, 11786, 11792,
+    11799, 11809, 11815, 11822, 11830, 11837, 11842, 11847, 11855, 11860, 11869, 11876, 11884, 11892, 11897, 11902,
+    11909, 11916, 11924, 11934, 11941, 11948, 11959, 11965, 11969, 11978, 11988, 11993, 12001, 12006, 12015, 12023,
+    12030, 12035, 12046, 12054, 12065, 12077, 12083, 12091, 12100, 12108, 12117, 12125, 12132, 12140, 12148, 12157,
+    12166, 12174, 12187, 12194, 12202, 12208, 12217, 12226, 12231, 12239, 12246, 12254, 12263, 12268, 12276, 12285,
+    12292, 12298, 12304, 12313, 12319, 12327, 12334, 12340, 12346, 12352, 12361, 12371, 12378, 12390, 12399, 12407,
+    12412, 12418, 12431, 12443, 12453, 12462, 12472, 12479, 12487, 12495, 12503, 12510, 12518, 12525, 12527, 12537,
+    12547, 12552, 12560, 12567, 12574, 12585, 12590, 12598, 12607, 12614, 12619, 12625, 12630, 12637, 12645, 12653,
+    12663, 12670, 12675, 12682, 12686, 12692, 12697, 12703, 12712, 12717, 12724, 12732, 12737, 12744, 12751, 12758,
+    12768, 12774, 12781, 12789, 12803, 12810, 12816, 12823, 12828, 12835, 12842, 12852, 12859, 12865, 12875, 12882,
+    12889, 12895, 12901, 12905, 12915, 12921, 12929, 12933, 12940, 12949, 12956, 12960, 12967, 12972, 12981, 12989,
+    12996, 13003, 13012, 13019, 13024, 13028, 13034, 13041, 13049, 13057, 13064, 13073, 13083, 13088, 13095, 13102,
+    13111, 13115, 13123, 13129, 13136, 13142, 13149, 13156, 13162, 13169, 13175, 13179, 13184, 13192, 13200, 13209,
+    13218, 13224, 13233, 13241, 13247, 13255, 13264, 13269, 13275, 13282, 13287, 13296, 13304, 13311, 13316, 13321,
+    13328, 13337, 13344, 13351, 13359, 13369, 13376, 13387, 13395, 13402, 13410, 13419, 13429, 13436, 13443, 13450,
+    13457, 13464, 13474, 13480, 13488, 13494, 13502, 13507, 13514, 13520, 13527, 13535, 13544, 13553, 13560, 13567,
+    13577, 13583, 13593, 13601, 13609, 13616, 13623, 13630, 13636, 13643, 13650, 13658, 13667, 13676, 13688, 13693,
+    13700, 13710, 13717, 13725, 13731, 13736, 13742, 13750, 13759, 13767, 13774, 13782, 13791, 13798, 13805, 13811,
+    13817, 13825, 13832, 13839, 13846, 13855, 13863, 13870, 13874, 13879, 13885, 13891, 13897, 13904, 13911, 13915,
+    13922, 13934, 13940, 13949, 13956, 13963, 13971, 13976, 13981, 13991, 13998, 14008, 14017, 14025, 14030, 14037,
+    14042, 14050, 14058, 14068, 14077, 14082, 14089, 14097, 14102, 14107, 14114, 14121, 14131, 14142, 14151, 14154,
+    14166, 14172, 14181, 14189, 14193, 14201, 14209, 14215, 14223, 14228, 14235, 14242, 14252, 14259, 14269, 14275,
+    14282, 14287, 14293, 14300, 14308, 14314, 14321, 14330, 14341, 14346, 14352, 14360, 14369, 14377, 14383, 14390,
+    14397, 14403, 14409, 14414, 14421, 14431, 14438, 14443, 14447, 14452, 14461, 14467, 14474, 14480, 14489, 14494,
+    14502, 14508, 14516, 14520, 14527, 14536, 14546, 14554, 14560, 14567, 14573, 14579, 14590, 14595, 14600, 14607,
+    14611, 14622, 14632, 14639, 14649, 14658, 14666, 14672, 14680, 14687, 14691, 14697, 14701, 14710, 14716, 14724,
+    14728, 14733, 14741, 14751, 14757, 14766, 14772, 14778, 14787, 14793, 14801, 14808, 14819, 14829, 14837, 14845,
+    14856, 14865, 14870, 14877, 14886, 14892, 14900, 14910, 14919, 14925, 14929, 14933, 14937, 14945, 14947, 14953,
+    14964, 14969, 14976, 14983, 14992, 14998, 15003, 15010, 15020, 15025, 15035, 15042, 15054, 15059, 15065, 15074,
+    15082, 15087, 15098, 15106, 15115, 15120, 15129, 15138, 15143, 15150, 15157, 15165, 15175, 15180, 15189, 15192,
+    15202, 15214, 15228, 15236, 15245, 15250, 15263, 15271, 15278, 15288, 15294, 15306, 15314, 15321, 15329, 15339,
+    15351, 15360, 15369, 15375, 15384, 15395, 15404, 15409, 15416, 15425, 15433, 15447, 15456, 15462, 15472, 15482,
+    15491, 15501, 15511, 15521, 15527, 15535, 15545, 15556, 15562, 15568, 15574, 15583, 15595, 15603, 15609, 15614,
+    15622, 15633, 15644, 15654, 15659, 15664, 15670, 15677, 15686, 15693, 15698, 15703, 15714, 15724, 15735, 15745,
+    15750, 15756, 15763, 15770, 15778, 15782, 15788, 15794, 15801, 15807, 15814, 15820, 15825, 15832, 15839, 15846,
+    15853, 15860, 15871, 15879, 15888, 15897, 15906, 15912, 15922, 15929, 15935, 15943, 15951, 15957, 15964, 15973,
+    15981, 15989, 15994, 16000, 16008, 16013, 16023, 16030, 16035, 16039, 16045, 16050, 16061, 16066, 16076, 16084,
+    16092, 16102, 16110, 16116, 16122, 16127, 16132, 16136, 16146, 16153, 16163, 16169, 16174, 16181, 16188, 16194,
+    16201, 16211, 16218, 16222, 16231, 16239, 16244, 16250, 16256, 16264, 16273, 16283, 16290, 16295, 16303, 16311,
+    16318, 16326, 16331, 16336, 16346, 16349, 16355, 16360, 16367, 16372, 16378, 16386, 16391, 16400, 16407, 16415,
+    16425, 16429, 16436, 16445, 16451, 16462, 16466, 16475, 16483, 16489, 16497, 16504, 16510, 16515, 16521, 16529,
+    16536, 16542, 16548, 16555, 16563, 16572, 16579, 16586, 16596, 16601, 16606, 16613, 16621, 16628, 16635, 16641,
+    16651, 16655, 16659, 16667, 16675, 16682, 16690, 16695, 16704, 16711, 16718, 16723, 16733, 16738, 16744, 16753,
+    16763, 16772, 16779, 16784, 16793, 16799, 16806, 16813, 16821, 16830, 16840, 16846, 16854, 16858, 16864, 16874,
+    16881, 16887, 16891, 16898, 16903, 16909, 16916, 16924, 16932, 16939, 16949, 16956, 16961, 16967, 16975, 16980,
+    16989, 16995, 17001, 17009, 17016, 17022, 17027, 17035, 17041, 17049, 17057, 17069, 17075, 17084, 17092, 17099,
+    17105, 17111, 17118, 17125, 17133, 17141, 17152, 17160, 17164, 17173, 17181, 17190, 17199, 17205, 17210, 17220,
+    17227, 17233, 17239, 17248, 17255, 17260, 17265, 17274, 17281, 17289, 17295, 17302, 17307, 17317, 17326, 17334,
+    17344, 17352, 17358, 17364, 17370, 17376, 17383, 17390, 17398, 17405, 17410, 17418, 17428, 17437, 17442, 17449,
+    17456, 17461, 17467, 17474, 17480, 17490, 17498, 17505, 17514, 17520, 17528, 17535, 17545, 17553, 17559, 17566,
+    17578, 17584, 17590, 17594, 17603, 17610, 17616, 17624, 17630, 17637, 17642, 17647, 17653, 17662, 17669, 17674,
+    17681, 17692, 17698, 17705, 17713, 17722, 17729, 17736, 17744, 17752, 17759, 17771, 17776, 17783, 17791, 17797,
+    17803, 17811, 17820, 17828, 17835, 17845, 17856, 17864, 17874, 17881, 17890, 17895, 17900, 17907, 17915, 17923,
+    17931, 17937, 17948, 17954, 17961, 17971, 17979, 17987, 17995, 18000, 18009, 18015, 18022, 18030, 18036, 18044,
+    18056, 18063, 18071, 18080, 18088, 18098, 18107, 18112, 18120, 18130, 18137, 18142, 18150, 18159, 18165, 18173,
+    18179, 18185, 18194, 18200, 18205, 18213, 18223, 18231, 18239, 18245, 18251, 18258, 18268, 18276, 18283, 18290,
+    18295, 18304, 18316, 18324, 18332, 18340, 18350, 18357, 18367, 18374, 18379, 18387, 18398, 18407, 18420, 18427,
+    18436, 18445, 18451, 18460, 18466, 18476, 18483, 18492, 18503, 18509, 18515, 18524, 18531, 18538, 18547, 18555,
+    18562, 18568, 18574, 18579, 18589, 18595, 18603, 18608, 18613, 18621, 18627, 18632, 18640, 18645, 18651, 18660,
+    18667, 18678, 18686, 18698, 18705, 18712, 18719, 18723, 18730, 18739, 18747, 18756, 18766, 18775, 18781, 18789,
+    18798, 18807, 18814, 18822, 18834, 18838, 18844, 18851, 18859, 18866, 18873, 18878, 18883, 18891, 18899, 18909,
+    18917, 18925, 18931, 18937, 18945, 18954, 18963, 18971, 18977, 18988, 18999, 19006, 19013, 19019, 19025, 19030,
+    19036, 19044, 19051, 19055, 19061, 19070, 19078, 19088, 19096, 19102, 19109, 19120, 19125, 19135, 19139, 19144,
+    19154, 19162, 19171, 19177, 19185, 19196, 19204, 19210, 19216, 19222, 19228, 19236, 19239, 19246, 19252, 19254,
+    19260, 19271, 19276, 19283, 19292, 19299, 19304, 19314, 19323, 19331, 19334, 19346, 19351, 19360, 19370, 19376,
+    19382, 19389, 19394, 19398, 19405, 19411, 19418, 19430, 19439, 19447, 19459, 19466, 19476, 19488, 19497, 19504,
+    19512, 19522, 19529, 19534, 19541, 19546, 19557, 19566, 19571, 19581, 19588, 19598, 19602, 19610, 19618, 19625,
+    19637, 19642, 19651, 19664, 19672, 19680, 19686, 19699, 19704, 19711, 19720, 19726, 19733, 19744, 19751, 19758,
+    19765, 19777, 19785, 19796, 19803, 19810, 19818, 19822, 19830, 19839, 19846, 19855, 19867, 19876, 19886, 19899,
+    19908, 19919, 19927, 19933, 19948, 19955, 19965, 19978, 19988, 19995, 20004, 20014, 20021, 20029, 20037, 20042,
+    20052, 20060, 20072, 20079, 20085, 20094, 20100, 20106, 20112, 20120, 20133, 20138, 20149, 20155, 20162, 20170,
+    20179, 20186, 20197, 20207, 20219, 20229, 20239, 20245, 20252, 20259, 20268, 20277, 20286, 20299, 20308, 20315,
+    20324, 20337, 20344, 20349, 20359, 20369, 20379, 20390, 20398, 20407, 20410, 20415, 20423, 20433, 20438, 20447,
+    20454, 20465, 20473, 20480, 20489, 20495, 20503, 20511, 20517, 20524, 20534, 20541, 20548, 20555, 20561, 20566,
+    20575, 20586, 20598, 20606, 20614, 20621, 20628, 20635, 20643, 20651, 20658, 20665, 20674, 20680, 20686, 20695,
+    20700, 20706, 20713, 20719, 20726, 20734, 20740, 20746, 20755, 20761, 20772, 20779, 20787, 20794, 20801, 20807,
+    20816, 20825, 20830, 20837, 20848, 20856, 20863, 20869, 20876, 20880, 20886, 20892, 20901, 20906, 20913, 20921,
+    20928, 20935, 20940, 20944, 20952, 20960, 20968, 20976, 20984, 20988, 20996, 21003, 21008, 21016, 21022, 21029,
+    21035, 21040, 21045, 21052, 21057, 21064, 21072, 21081, 21089, 21100, 21107, 21112, 21119, 21129, 21135, 21141,
+    21149, 21156, 21160, 21170, 21176, 21185, 21192, 21200, 21205, 21209, 21215, 21224, 21230, 21239, 21246, 21255,
+    21264, 21271, 21276, 21284, 21289, 21296, 21302, 21309, 21315, 21322, 21328, 21335, 21343, 21355, 21361, 21366,
+    21376, 21381, 21388, 21395, 21402, 21412, 21420, 21427, 21433, 21443, 21449, 21454, 21464, 21470, 21479, 21486,
+    21491, 21504, 21509, 21517, 21524, 21531, 21538, 21545, 21555, 21561, 21571, 21580, 21584, 21593, 21599, 21609,
+    21611, 21616, 21624, 21633, 21642, 21652, 21658, 21666, 21673, 21679, 21684, 21690, 21694, 21701, 21708, 21713,
+    21721, 21727, 21731, 21740, 21743, 21750, 21759, 21765, 21773, 21781, 21789, 21798, 21806, 21814, 21820, 21825,
+    21831, 21839, 21849, 21856, 21862, 21871, 21878, 21885, 21893, 21901, 21905, 21912, 21921, 21927, 21936, 21945,
+    21953, 21959, 21969, 21978, 21989, 21997, 22004, 22015, 22022, 22032, 22039, 22047, 22053, 22061, 22072, 22080,
+    22086, 22095, 22106, 22116, 22123, 22129, 22136, 22143, 22149, 22157, 22163, 22170, 22176, 22186, 22193, 22200,
+    22212, 22217, 22222, 22228, 22238, 22248, 22257, 22266, 22274, 22282, 22290, 22296, 22302, 22310, 22317, 22323,
+    22329, 22334, 22342, 22351, 22361, 22368, 22380, 22389, 22396, 22405, 22410, 22417, 22427, 22433, 22442, 22449,
+    22458, 22463, 22469, 22475, 22482, 22488, 22498, 22509, 22518, 22524, 22532, 22541, 22547, 22554, 22560, 22568,
+    22573, 22582, 22588, 22594, 22605, 22611, 22620, 22626, 22632, 22641, 22647, 22654, 22661, 22667, 22675, 22682,
+    22692, 22698, 22702, 22709, 22715, 22719, 22726, 22733, 22738, 22743, 22752, 22758, 22769, 22777, 22781, 22788,
+    22792, 22798, 22804, 22810, 22816, 22821, 22827, 22837, 22843, 22850, 22857, 22866, 22876, 22882, 22890, 22897,
+    22909, 22915, 22922, 22933, 22939, 22945, 22952, 22963, 22973, 22980, 22987, 22992, 23003, 23013, 23022, 23027,
+    23032, 23039, 23044, 23048, 23054, 23062, 23066, 23073, 23082, 23086, 23092, 23101, 23110, 23119, 23125, 23134,
+    23143, 23151, 23160, 23171, 23178, 23187, 23195, 23203, 23209, 23218, 23226, 23232, 23240, 23243, 23249, 23257,
+    23264, 23271, 23278, 23282, 23290, 23298, 23303, 23312, 23316, 23324, 23331, 23336, 23342, 23348, 23357, 23364,
+    23374, 23383, 23390, 23395, 23401, 23406, 23413, 23423, 23433, 23440, 23446, 23453, 23463, 23471, 23481, 23489,
+    23499, 23504, 23509, 23516, 23524, 23530, 23536, 23543, 23552, 23559, 23567, 23576, 23583, 23591, 23597, 23604,
+    23611, 23617, 23623, 23632, 23639, 23644, 23658, 23666, 23674, 23678, 23683, 23691, 23697, 23704, 23706, 23716,
+    23725, 23736, 23742, 23750, 23758, 23766, 23775, 23785, 23794, 23804, 23809, 23815, 23821, 23826, 23832, 23843,
+    23852, 23858, 23864, 23869, 23875, 23882, 23886, 23893, 23902, 23908, 23915, 23924, 23932, 23942, 23951, 23961,
+    23968, 23975, 23983, 23990, 23996, 24002, 24010, 24017, 24024, 24033, 24037, 24043, 24053, 24061, 24070, 24078,
+    24085, 24095, 24105, 24110, 24117, 24125, 24132, 24138, 24145, 24152, 24158, 24165, 24173, 24182, 24187, 24196,
+    24205, 24214, 24222, 24231, 24240, 24248, 24258, 24263, 24270, 24280, 24290, 24297, 24308, 24314, 24321, 24330,
+    24337, 24343, 24349, 24354, 24360, 24366, 24374, 24386, 24394, 24403, 24412, 24419, 24425, 24432, 24440, 24449,
+    24456, 24463, 24470, 24478, 24489, 24495, 24502, 24509, 24516, 24520, 24527, 24532, 24540, 24546, 24552, 24559,
+    24566, 24575, 24585, 24593, 24602, 24612, 24617, 24620, 24626, 24637, 24644, 24650, 24655, 24667, 24674, 24684,
+    24693, 24704, 24713, 24719, 24726, 24736, 24743, 24753, 24764, 24774, 24780, 24790, 24796, 24806, 24812, 24822,
+    24828, 24835, 24841, 24847, 24853, 24863, 24872, 24878, 24886, 24899, 24907, 24915, 24923, 24930, 24938, 24949,
+    24956, 24964, 24972, 24980, 24989, 25001, 25007, 25016, 25022, 25031, 25040, 25049, 25055, 25063, 25069, 25075,
+    25085, 25093, 25099, 25104, 25111, 25119, 25126, 25130, 25136, 25145, 25151, 25158, 25167, 25175, 25183, 25192,
+    25199, 25207, 25216, 25226, 25230, 25237, 25244, 25250, 25257, 25266, 25276, 25281, 25294, 25299, 25309, 25316,
+    25321, 25327, 25334, 25345, 25350, 25356, 25363, 25370, 25377, 25386, 25394, 25399, 25406, 25412, 25418, 25427,
+    25434, 25441, 25449, 25456, 25465, 25472, 25478, 25482, 25491, 25501, 25511, 25518, 25528, 25535, 25547, 25555,
+    25565, 25572, 25577, 25585, 25597, 25604, 25611, 25619, 25624, 25631, 25642, 25651, 25658, 25668, 25675, 25683,
+    25691, 25699, 25707, 25718, 25727, 25736, 25742, 25752, 25758, 25765, 25774, 25785, 25790, 25796, 25803, 25812,
+    25819, 25824, 25831, 25839, 25846, 25854, 25859, 25867, 25879, 25888, 25893, 25901, 25905, 25914, 25920, 25931,
+    25936, 25945, 25952, 25957, 25965, 25971, 25978, 25990, 25998, 26003, 26010, 26016, 26024, 26031, 26042, 26052,
+    26058, 26067, 26074, 26078, 26084, 26090, 26100, 26109, 26116, 26122, 26134, 26141, 26148, 26152, 26159, 26163,
+    26168, 26179, 26185, 26191, 26197, 26203, 26211, 26221, 26231, 26241, 26250, 26257, 26266, 26271, 26277, 26286,
+    26290, 26299, 26307, 26312, 26320, 26330, 26337, 26344, 26352, 26360, 26369, 26379, 26386, 26393, 26400, 26407,
+    26414, 26422, 26432, 26441, 26449, 26457, 26464, 26469, 26476, 26482, 26490, 26496, 26501, 26510, 26520, 26529,
+    26538, 26546, 26560, 26567, 26577, 26585, 26596, 26605, 26613, 26619, 26623, 26629, 26636, 26642, 26647, 26653,
+    26664, 26672, 26678, 26686, 26692, 26696, 26702, 26711, 26720, 26729, 26734, 26745, 26752, 26763, 26769, 26775,
+    26783, 26790, 26797, 26803, 26811, 26822, 26828, 26834, 26845, 26851, 26857, 26864, 26874, 26880, 26885, 26892,
+    26900, 26906, 26914, 26921, 26931, 26934, 26939, 26946, 26955, 26965, 26972, 26984, 26989, 26996, 27003, 27009,
+    27014, 27024, 27035, 27041, 27050, 27055, 27062, 27072, 27081, 27090, 27096, 27104, 27110, 27118, 27124, 27131,
+    27135, 27141, 27148, 27154, 27162, 27172, 27181, 27188, 27194, 27203, 27211, 27220, 27228, 27236, 27243, 27248,
+    27256, 27262, 27271, 27278, 27282, 27293, 27302, 27309, 27317, 27326, 27332, 27340, 27346, 27354, 27362, 27370,
+    27374, 27380, 27390, 27398, 27406, 27415, 27421, 27433, 27439, 27446, 27456, 27465, 27471, 27478, 27486, 27497,
+    27504, 27510, 27519, 27526, 27534, 27539, 27551, 27556, 27564, 27571, 27578, 27592, 27599, 27606, 27614, 27620,
+    27627, 27631, 27635, 27646, 27651, 27659, 27663, 27671, 27677, 27688, 27697, 27708, 27713, 27721, 27729, 27736,
+    27744, 27749, 27755, 27764, 27772, 27782, 27790, 27797, 27806, 27814, 27822, 27832, 27840, 27847, 27855, 27861,
+    27870, 27875, 27884, 27892, 27898, 27903, 27910, 27913, 27920, 27929, 27938, 27947, 27955, 27967, 27973, 27982,
+    27991, 28000, 28006, 28014, 28022, 28028, 28038, 28047, 28056, 28063, 28068, 28073, 28080, 28086, 28091, 28100,
+    28109, 28118, 28126, 28139, 28152, 28158, 28166, 28174, 28182, 28188, 28201, 28208, 28219, 28228, 28234, 28245,
+    28255,
+};
+
+// Vocabulary ids ordered by strcmp() of their words, for binary search
+const uint16_t VOCAB_SORTED[VOCAB_COUNT] PROGMEM = {
+    22, 3, 8, 388, 464, 1186, 2237, 11, 43, 0, 2, 1, 17, 10, 2676, 3641,
+    3770, 2809, 1075, 2913, 1240, 171, 1569, 1702, 2177, 1937, 3163, 1980, 2425, 2760, 2086, 2299,
+    1983, 2591, 1040, 1399, 1212, 2442, 2113, 3437, 1449, 1479, 567, 2412, 985, 2108, 2879, 2950,
+    3863, 3599, 3088, 2261, 3615, 2510, 3335, 3573, 3799, 1138, 1577, 2124, 2090, 3682, 1317, 3247,
+    2753, 3215, 2818, 2935, 1088, 1573, 2298, 1877, 2690, 2155, 3753, 3942, 3651, 3471, 1754, 2022,
+    3192, 3896, 190, 3841, 2494, 612, 170, 164, 462, 3075, 3469, 1737, 3872, 896, 1362, 708,
+    1046, 1457, 353, 2431, 555, 3300, 1420, 40, 1450, 674, 370, 763, 3817, 3431, 664, 851,
+    3100, 1978, 3001, 3031, 292, 81, 2102, 3832, 2180, 2393, 1177, 3681, 2316, 2939, 2495, 1181,
+    3126, 3621, 82, 3736, 868, 5, 2433, 997, 2163, 511, 2554, 1689, 2509, 1343, 3931, 3388,
+    3417, 1011, 283, 3253, 291, 1039, 897, 3943, 3167, 591, 1209, 114, 3236, 3492, 3032, 3718,
+    3562, 874, 1252, 970, 1473, 2483, 3052, 1999, 2838, 3155, 3367, 1326, 1198, 45, 3485, 1448,
+    3416, 2448, 1199, 635, 3188, 467, 2190, 2602, 2877, 2293, 3162, 3344, 3407, 3287, 1853, 128,
+    577, 2774, 2221, 2612, 28, 3379, 1150, 2492, 844, 891, 1827, 2466, 2981, 273, 1556, 3937,
+    1141, 3734, 1753, 1803, 1955, 2153, 2195, 1201, 61, 3638, 2539, 1828, 1930, 2956, 349, 3457,
+    2583, 563, 2896, 2212, 1820, 3020, 3731, 2949, 3528, 3660, 3972, 545, 1007, 2254, 3997, 150,
+    3277, 3301, 579, 1994, 3727, 727, 3715, 3667, 845, 375, 536, 2934, 914, 3813, 1294, 3849,
+    1165, 1423, 1908, 1491, 3921, 1722, 2435, 2239, 2484, 2575, 846, 2502, 1463, 2382, 2817, 1813,
+    3057, 23, 2871, 3442, 2038, 1038, 3912, 240, 1132, 1192, 983, 1543, 1802, 2443, 2200, 3263,
+    1401, 2990, 2683, 785, 486, 633, 1741, 270, 3531, 356, 1895, 172, 406, 3213, 135, 2923,
+    1388, 881, 1041, 1652, 2250, 1777, 3769, 1280, 839, 1808, 2054, 2370, 3347, 2202, 2367, 3773,
+    2259, 3466, 1242, 1468, 583, 3227, 97, 405, 1867, 2888, 2551, 1542, 3857, 2500, 1971, 3745,
+    2470, 3180, 568, 919, 1996, 2372, 2967, 1894, 439, 2414, 2506, 793, 296, 1679, 3231, 3176,
+    2588, 1700, 160, 3780, 1490, 565, 2552, 2131, 1127, 1685, 3948, 297, 1788, 3341, 2662, 553,
+    3545, 1019, 2815, 1107, 3134, 1155, 3046, 1124, 693, 1262, 3918, 3421, 2714, 1314, 1066, 2734,
+    2342, 1928, 3053, 2065, 183, 482, 1112, 2352, 1805, 1812, 2739, 2318, 1710, 2148, 2780, 3321,
+    1807, 398, 2308, 873, 990, 2590, 3767, 2499, 3816, 1129, 1947, 1189, 909, 1748, 3953, 745,
+    3575, 491, 3108, 1677, 2314, 671, 2767, 187, 3368, 1789, 2995, 681, 3049, 1390, 3220, 1831,
+    376, 2377, 3946, 2024, 2002, 2636, 943, 1667, 1635, 1747, 534, 2725, 2123, 3024, 359, 2693,
+    1274, 2386, 798, 3818, 1659, 1649, 1114, 1872, 1357, 1392, 3974, 2893, 260, 1960, 1671, 3497,
+    1065, 987, 2715, 185, 514, 449, 1318, 2053, 276, 944, 955, 2731, 1643, 1618, 1745, 1092,
+    2182, 3150, 3000, 658, 731, 27, 3212, 1180, 41, 1451, 1368, 234, 1047, 2672, 3895, 2207,
+    3952, 162, 703, 3504, 2537, 2421, 3928, 2424, 230, 120, 3076, 151, 801, 2666, 3279, 2129,
+    797, 2646, 1891, 2479, 1492, 452, 617, 496, 3450, 3113, 1640, 1195, 723, 2232, 1367, 341,
+    510, 730, 2081, 3590, 1424, 1426, 3390, 263, 2886, 1621, 2119, 2236, 3830, 3613, 3721, 1551,
+    1113, 865, 3373, 2050, 3765, 2027, 899, 3557, 1311, 3939, 2973, 516, 2654, 3654, 753, 498,
+    3535, 2983, 1044, 3004, 2668, 3243, 3604, 3529, 1433, 1778, 2716, 2895, 1763, 2300, 1724, 1069,
+    707, 3688, 637, 2226, 2008, 2887, 2936, 3094, 1350, 1384, 645, 3290, 3382, 3168, 2021, 1651,
+    1070, 2000, 2084, 1544, 1932, 3281, 2392, 2845, 619, 3801, 876, 679, 1247, 2741, 1875, 2287,
+    3594, 2023, 1084, 2968, 3628, 1845, 3826, 3585, 1355, 1024, 2943, 3563, 1456, 3642, 2307, 2146,
+    1291, 2653, 518, 1581, 2283, 1236, 2197, 2497, 70, 173, 434, 2046, 651, 3710, 1284, 3825,
+    879, 1660, 1774, 908, 517, 3568, 1361, 1686, 2223, 665, 2598, 3008, 2379, 3074, 3694, 832,
+    1688, 704, 235, 830, 2273, 3890, 1997, 799, 1847, 2355, 3204, 2505, 1597, 2639, 3111, 1228,
+    714, 2699, 2868, 734, 2309, 2816, 1331, 3286, 3823, 3747, 3222, 1740, 2633, 2400, 2899, 2413,
+    3239, 3954, 787, 825, 2755, 2866, 2075, 1558, 3494, 1939, 3524, 378, 2533, 3521, 2409, 3930,
+    1153, 1857, 3987, 1484, 542, 3436, 3864, 3453, 2139, 2746, 2751, 2951, 2696, 1214, 2948, 3797,
+    1582, 3829, 2248, 725, 3371, 3083, 3330, 3251, 1680, 1431, 3331, 2152, 2670, 2091, 145, 3474,
+    2723, 3932, 1269, 815, 2127, 1670, 2958, 2532, 3123, 2455, 1110, 3275, 3589, 1245, 676, 921,
+    2033, 3118, 1564, 3583, 3846, 773, 570, 1233, 3314, 3112, 3136, 3117, 2577, 3867, 3496, 623,
+    1480, 3432, 3299, 3063, 872, 1650, 1338, 1222, 833, 1882, 2418, 1220, 442, 1307, 473, 1750,
+    1330, 3274, 594, 2605, 989, 2167, 3356, 3875, 2009, 2652, 3686, 854, 2063, 2986, 3193, 2717,
+    3659, 3647, 2229, 435, 3631, 1642, 3722, 30, 1920, 1466, 1516, 2631, 1344, 502, 3154, 828,
+    3936, 1034, 814, 3106, 1612, 863, 2508, 2120, 1272, 3598, 3925, 277, 2489, 115, 621, 1216,
+    428, 168, 1967, 2757, 2685, 2491, 2480, 1868, 525, 125, 2337, 2576, 3520, 2468, 3435, 1842,
+    1854, 756, 2853, 2258, 3632, 3657, 1886, 2933, 244, 904, 1705, 1096, 3626, 713, 337, 3460,
+    546, 3156, 1576, 2011, 949, 2286, 3775, 3085, 3961, 1173, 2042, 1924, 2231, 1644, 902, 1540,
+    1328, 972, 2870, 2203, 2361, 2044, 1149, 1063, 2403, 3210, 2371, 3693, 2045, 418, 3993, 2848,
+    1077, 2454, 3966, 2740, 2339, 2897, 2303, 3883, 389, 1225, 2773, 1471, 3221, 2880, 3101, 3122,
+    2570, 2738, 1378, 2304, 3692, 2359, 2436, 2351, 2349, 1742, 3486, 2094, 87, 717, 395, 871,
+    1662, 3377, 3804, 2106, 3674, 1614, 2049, 2257, 3478, 2928, 550, 3050, 1992, 2580, 2107, 3401,
+    2681, 578, 1884, 3483, 3408, 3571, 1526, 2960, 1829, 2438, 1550, 2141, 1364, 3653, 2230, 3060,
+    1591, 1265, 2616, 3834, 2611, 962, 1757, 3548, 1849, 3792, 634, 3194, 3430, 3452, 2709, 3979,
+    54, 1437, 123, 611, 2589, 767, 410, 1261, 3677, 2225, 1264, 1193, 3400, 188, 1647, 2078,
+    1204, 1409, 2415, 2158, 339, 143, 1036, 3588, 469, 3754, 3294, 3354, 2850, 258, 222, 3549,
+    1090, 566, 2396, 2404, 1779, 2344, 1500, 639, 1698, 466, 2285, 2908, 3856, 2456, 3120, 3795,
+    803, 3891, 1363, 3810, 1231, 1848, 3877, 2445, 1952, 1987, 3152, 3764, 3669, 1477, 3410, 1785,
+    741, 205, 1312, 1125, 3249, 720, 2394, 1139, 1105, 3175, 629, 2198, 3323, 368, 3225, 1160,
+    2814, 308, 3842, 2834, 493, 765, 1806, 1068, 3655, 1784, 314, 969, 2172, 1137, 2388, 2260,
+    826, 960, 3392, 1333, 3771, 3534, 781, 1256, 1123, 1846, 2402, 1534, 1631, 399, 3964, 1988,
+    2387, 3576, 3482, 1888, 3889, 281, 2114, 2178, 2420, 3774, 2354, 2586, 2930, 2302, 2776, 3509,
+    1504, 2825, 1903, 2940, 321, 3142, 2889, 2347, 1419, 1519, 877, 1152, 3127, 3565, 2963, 262,
+    1462, 527, 2157, 3988, 2266, 3223, 393, 3719, 455, 2688, 2192, 3185, 1253, 1498, 1769, 2362,
+    2066, 3695, 2291, 3533, 3276, 250, 1366, 1694, 3944, 1168, 2966, 3171, 2301, 3920, 1398, 3922,
+    3007, 657, 3340, 206, 217, 1389, 3532, 3327, 272, 1502, 3195, 419, 979, 1372, 1079, 571,
+    1885, 2263, 2810, 1327, 2514, 483, 1929, 3360, 782, 3068, 2463, 3687, 2744, 2092, 3973, 2802,
+    2187, 2926, 2310, 3495, 2686, 2691, 3319, 2863, 3934, 1730, 2858, 274, 180, 2665, 1972, 229,
+    2067, 2294, 2553, 2847, 1395, 2519, 2910, 161, 2085, 3763, 1830, 330, 2043, 1658, 2777, 3104,
+    287, 3757, 1985, 2069, 3201, 347, 3208, 3712, 2727, 2026, 1045, 1797, 3391, 3597, 3898, 1010,
+    911, 3240, 355, 547, 2750, 1976, 1017, 792, 2390, 2365, 996, 3904, 157, 400, 3777, 522,
+    1278, 940, 3374, 796, 208, 1179, 1606, 3184, 3055, 1447, 3871, 1329, 2692, 3429, 3230, 2088,
+    2523, 1767, 1428, 1279, 3458, 3820, 574, 239, 1927, 1555, 3812, 2389, 2029, 840, 950, 1067,
+    709, 3270, 2705, 3708, 1342, 2596, 3065, 3393, 638, 1775, 1263, 1839, 3919, 409, 309, 2450,
+    2840, 1683, 1018, 2842, 2338, 1196, 390, 2358, 2942, 178, 597, 3284, 1136, 2240, 3296, 2103,
+    1905, 2804, 1641, 795, 2957, 3620, 1140, 3612, 2795, 3881, 3836, 3965, 3755, 1790, 1873, 2071,
+    1637, 1495, 2823, 1012, 1666, 2378, 3844, 374, 1289, 2747, 1969, 1496, 3584, 1202, 1400, 1167,
+    294, 965, 698, 1567, 901, 1221, 18, 2700, 1726, 3751, 749, 1940, 1162, 3141, 3605, 672,
+    1707, 1347, 1623, 774, 1664, 2530, 1335, 1288, 3860, 2210, 317, 3717, 3174, 3609, 320, 827,
+    1525, 2093, 3396, 459, 257, 2629, 2548, 967, 3779, 3343, 2707, 323, 3511, 3369, 264, 2805,
+    3214, 3926, 3870, 427, 1945, 472, 3578, 1197, 2830, 275, 3224, 261, 2353, 916, 1697, 3995,
+    2742, 978, 60, 3676, 3183, 2758, 2749, 3732, 236, 3387, 3608, 3114, 3784, 2800, 670, 1943,
+    2417, 1816, 2477, 1536, 3349, 1277, 1746, 3629, 3933, 3956, 1922, 1911, 2600, 1547, 1535, 748,
+    1630, 2852, 3855, 3606, 2323, 3945, 642, 2220, 3394, 3998, 1768, 148, 315, 584, 3909, 2655,
+    2735, 1585, 2828, 365, 3923, 1648, 3069, 1921, 1798, 3125, 3317, 116, 660, 884, 1933, 543,
+    1207, 3955, 794, 1772, 2434, 1513, 2996, 1752, 2452, 3451, 2904, 1879, 119, 129, 460, 199,
+    711, 1009, 732, 739, 3887, 269, 59, 3433, 3219, 1735, 2213, 580, 1645, 2736, 2969, 2807,
+    212, 1376, 1970, 506, 3054, 2718, 3523, 1461, 1549, 3854, 2251, 3999, 499, 2498, 3197, 2380,
+    112, 1283, 1441, 2222, 1610, 3983, 847, 3022, 3315, 951, 2564, 2772, 3415, 2476, 2697, 945,
+    2645, 2974, 1511, 3739, 538, 2679, 685, 1528, 3028, 1654, 3463, 1386, 2473, 1332, 1248, 2186,
+    3397, 2336, 3030, 2711, 710, 3619, 381, 2097, 3672, 52, 2462, 2406, 1085, 1465, 1482, 705,
+    497, 137, 3614, 2277, 1416, 310, 3696, 530, 2118, 2490, 3233, 1082, 1464, 2025, 1782, 603,
+    654, 1916, 3789, 3917, 2623, 2763, 1055, 3333, 1109, 2055, 1521, 377, 159, 869, 1049, 1119,
+    521, 3418, 1998, 3711, 89, 620, 2328, 1091, 37, 764, 3425, 149, 890, 3519, 25, 195,
+    1296, 907, 984, 809, 271, 165, 1073, 1792, 155, 2765, 2748, 461, 3311, 2516, 3685, 154,
+    2150, 788, 1267, 948, 186, 2569, 1674, 118, 2151, 3868, 2343, 1731, 1027, 917, 1545, 470,
+    1913, 407, 360, 3781, 1993, 42, 3498, 146, 3472, 2112, 1043, 1995, 616, 2778, 1962, 3684,
+    3191, 1923, 1990, 786, 2791, 2786, 316, 2982, 3178, 939, 3086, 33, 233, 284, 3268, 24,
+    3372, 2191, 361, 790, 850, 3806, 3351, 238, 736, 2624, 1276, 2730, 1665, 110, 458, 282,
+    251, 2839, 2428, 3138, 1004, 333, 3477, 1982, 777, 1051, 3362, 2573, 3743, 344, 2160, 3051,
+    1254, 3081, 2959, 3370, 1817, 3833, 494, 1111, 1883, 1142, 729, 3607, 2276, 433, 928, 2674,
+    191, 1949, 1959, 83, 2297, 2593, 3701, 1166, 2013, 1117, 1898, 1121, 1843, 2844, 1718, 3289,
+    1906, 849, 2324, 2543, 1478, 726, 2657, 1115, 307, 1793, 1893, 9, 615, 3378, 2756, 2937,
+    1148, 1855, 1336, 2327, 2698, 2660, 1523, 3698, 3107, 44, 3587, 1732, 2546, 2126, 113, 327,
+    3402, 2733, 2522, 2439, 613, 2799, 3611, 3058, 3679, 2047, 1844, 2219, 3709, 3206, 3543, 2701,
+    2905, 3670, 12, 2945, 3876, 2841, 246, 1059, 2540, 3572, 3702, 2618, 3673, 2282, 2826, 2096,
+    3640, 3207, 3271, 1293, 549, 3874, 3959, 2673, 3242, 1815, 2135, 1486, 3181, 1172, 1681, 3894,
+    1352, 2171, 3866, 3480, 1968, 2931, 3019, 142, 445, 2469, 2280, 2921, 1571, 3643, 3840, 1889,
+    2292, 3985, 1578, 3010, 602, 3016, 1755, 548, 3202, 3047, 3025, 2079, 3579, 2503, 1880, 993,
+    16, 1695, 3514, 1339, 1633, 20, 2312, 513, 1865, 618, 1126, 1062, 861, 688, 824, 2656,
+    3958, 1838, 759, 2859, 1878, 2907, 656, 1874, 1385, 1211, 892, 544, 1579, 1203, 3375, 2989,
+    810, 267, 1234, 691, 1588, 3265, 332, 2728, 501, 508, 1600, 1861, 2587, 2058, 2898, 101,
+    1156, 2559, 3487, 481, 1238, 640, 2423, 3690, 1383, 2954, 800, 3950, 2242, 1507, 2610, 1469,
+    564, 1787, 750, 3232, 3582, 2482, 96, 628, 3339, 935, 1030, 1048, 903, 2544, 2953, 364,
+    3139, 2787, 3991, 1518, 3376, 1244, 1445, 682, 215, 3892, 1255, 1052, 915, 3551, 2980, 3536,
+    1703, 394, 3756, 2947, 1620, 1295, 3897, 3714, 1481, 3067, 351, 2764, 558, 3226, 1743, 3157,
+    1285, 2788, 286, 3851, 1899, 2687, 134, 3395, 385, 968, 1734, 864, 3901, 2214, 3553, 2878,
+    646, 1000, 735, 1365, 559, 216, 2574, 3045, 975, 1859, 2087, 2669, 422, 3285, 2566, 2507,
+    1345, 1514, 2474, 1835, 3161, 1834, 684, 3038, 2138, 1869, 1915, 69, 2782, 338, 417, 2441,
+    2999, 2059, 1259, 954, 599, 573, 1108, 141, 3525, 304, 2558, 2271, 2708, 2501, 94, 1602,
+    3096, 3037, 3305, 3538, 2014, 590, 1646, 1485, 947, 2208, 3539, 189, 1655, 213, 3927, 3267,
+    489, 942, 2268, 980, 2874, 1081, 1622, 3526, 3018, 2111, 3793, 2970, 3147, 1776, 1568, 721,
+    3649, 227, 1028, 3729, 523, 156, 2835, 537, 1417, 2729, 805, 67, 515, 1458, 1230, 3978,
+    1056, 3916, 382, 722, 3098, 79, 2345, 1147, 971, 424, 932, 1379, 2918, 1102, 3835, 3484,
+    3013, 3169, 2650, 2041, 3040, 2614, 415, 1095, 2988, 2036, 1739, 2205, 937, 1058, 2678, 432,
+    325, 1402, 132, 3878, 1016, 3404, 686, 2997, 1810, 3907, 2793, 2493, 607, 3092, 780, 2541,
+    1986, 3203, 2584, 3292, 90, 3555, 303, 598, 569, 687, 1907, 3087, 1170, 57, 2319, 2579,
+    3976, 3489, 804, 1870, 609, 700, 2812, 201, 3137, 887, 3423, 3665, 474, 500, 3244, 2702,
+    1574, 503, 855, 322, 279, 3329, 386, 3675, 3893, 372, 541, 1227, 181, 626, 78, 3266,
+    758, 29, 362, 404, 425, 1708, 905, 1031, 2856, 889, 2427, 2568, 3880, 288, 2183, 3337,
+    413, 666, 2209, 2061, 2051, 1020, 117, 1822, 1003, 1595, 856, 2224, 495, 2245, 2849, 1538,
+    2651, 3544, 920, 3121, 1966, 1919, 3791, 596, 3383, 2015, 3947, 3479, 2604, 174, 1672, 1001,
+    3424, 3768, 587, 531, 2719, 3363, 126, 3652, 2706, 2515, 2789, 2216, 3726, 3542, 2064, 659,
+    2133, 1783, 1239, 627, 1128, 1440, 852, 2227, 3512, 1190, 437, 3165, 2615, 1727, 3592, 641,
+    680, 346, 1837, 3862, 76, 2243, 2007, 463, 247, 2796, 941, 831, 1499, 38, 241, 1006,
+    1405, 3809, 3644, 1984, 986, 1218, 2822, 2603, 1826, 3550, 3302, 3350, 779, 507, 2984, 2311,
+    2911, 2416, 3131, 295, 124, 3603, 724, 2536, 1760, 2542, 728, 2695, 3992, 3132, 812, 92,
+    15, 754, 1382, 2944, 1696, 1901, 1387, 166, 632, 1268, 3173, 1824, 1942, 1407, 2667, 1348,
+    1163, 300, 1539, 2143, 179, 3262, 1050, 1836, 2241, 1691, 2193, 1634, 1926, 1527, 454, 1709,
+    3044, 3066, 1032, 526, 3455, 2745, 1946, 1299, 2005, 1185, 3011, 738, 1470, 152, 379, 358,
+    363, 2622, 561, 2459, 3490, 3403, 122, 3148, 1436, 3552, 1725, 3637, 46, 182, 3808, 2582,
+    1101, 2234, 245, 3491, 147, 1432, 2364, 1712, 1249, 19, 3941, 655, 163, 2481, 3190, 64,
+    2527, 1438, 3144, 3357, 791, 88, 746, 2529, 2475, 3229, 3906, 1587, 3464, 3902, 2638, 1213,
+    1856, 1572, 2883, 930, 2628, 1965, 3704, 3017, 1414, 248, 7, 214, 702, 3577, 1013, 1235,
+    3668, 2255, 600, 1957, 1974, 589, 918, 2196, 716, 595, 133, 192, 1821, 2547, 51, 221,
+    73, 512, 1925, 504, 3796, 582, 2663, 2952, 1765, 743, 2317, 2356, 3802, 56, 1759, 3561,
+    652, 3748, 1628, 535, 1454, 3146, 2373, 2682, 1078, 175, 336, 1687, 448, 816, 63, 1786,
+    99, 3703, 2132, 1592, 1210, 3975, 1738, 266, 193, 2781, 3459, 3129, 1964, 1711, 1005, 2322,
+    3805, 1910, 3059, 592, 2512, 3558, 1157, 2039, 3336, 301, 3062, 1237, 3530, 1871, 259, 2978,
+    2218, 752, 2894, 3645, 1145, 2803, 2184, 1301, 2296, 1071, 1072, 2206, 922, 1303, 808, 524,
+    3935, 2619, 3680, 581, 1025, 2381, 2712, 2941, 669, 202, 3967, 3963, 3624, 3446, 2872, 1692,
+    1714, 3440, 2076, 2560, 2797, 3282, 575, 3560, 1354, 1682, 866, 3422, 1337, 2060, 3413, 3308,
+    775, 2083, 3749, 3705, 3787, 480, 2288, 1896, 3468, 1809, 1892, 3166, 3264, 2134, 2607, 3170,
+    3815, 981, 1639, 2684, 3398, 1953, 3566, 3386, 1887, 1118, 2430, 3346, 2592, 1375, 2249, 3996,
+    1319, 3438, 1023, 198, 1761, 1509, 2211, 3980, 1258, 3716, 3199, 1948, 268, 2857, 2035, 2620,
+    2534, 1624, 1412, 348, 1483, 3625, 2975, 643, 3186, 2635, 2170, 2018, 2472, 3962, 2270, 1487,
+    695, 3269, 1381, 3794, 1851, 2295, 2929, 2581, 2496, 1251, 2946, 1015, 224, 3306, 3634, 998,
+    2626, 2752, 2104, 2608, 2689, 2363, 1074, 2062, 2920, 3462, 3291, 3077, 3158, 3313, 380, 3968,
+    2105, 2145, 3089, 878, 2932, 2098, 2658, 551, 3924, 194, 2453, 1723, 2432, 823, 3182, 2664,
+    3938, 2397, 3295, 822, 3658, 683, 383, 2020, 715, 2275, 2305, 1086, 3110, 2487, 3989, 2843,
+    3666, 1184, 3003, 1302, 2737, 2068, 3591, 3567, 857, 2485, 298, 1425, 882, 2384, 733, 1286,
+    3414, 1586, 3238, 1864, 3254, 2890, 1729, 3481, 3507, 3742, 2391, 3859, 3776, 2030, 3309, 2661,
+    2110, 744, 3256, 3099, 1188, 1054, 2511, 3929, 3332, 2976, 3406, 476, 1918, 3298, 1897, 636,
+    505, 3470, 1553, 2253, 1371, 2867, 2854, 2640, 1273, 2925, 3884, 3385, 3310, 2077, 3595, 1033,
+    2572, 1191, 402, 1443, 280, 1275, 1758, 3135, 2798, 211, 3103, 2019, 3600, 3399, 3211, 3324,
+    2130, 3580, 1053, 1912, 3515, 2233, 2721, 440, 3411, 3312, 610, 3153, 3700, 1305, 3322, 1290,
+    819, 3903, 3837, 2188, 802, 1353, 3119, 696, 1973, 3095, 2052, 1954, 3821, 2128, 2199, 3358,
+    2821, 2824, 2006, 2535, 2571, 3746, 256, 444, 1122, 631, 1292, 1080, 2179, 1852, 2037, 880,
+    1863, 2927, 3034, 334, 1223, 3540, 3510, 895, 2632, 1429, 1850, 977, 2906, 2794, 3723, 2451,
+    3911, 2955, 3537, 625, 3454, 2641, 2625, 3021, 3960, 2374, 1563, 1632, 3639, 3650, 2754, 999,
+    1862, 2016, 3735, 1453, 2521, 2801, 2279, 757, 1938, 312, 1557, 1130, 1766, 3237, 1661, 3109,
+    3293, 2846, 2278, 1823, 3448, 3426, 3093, 1349, 2881, 2346, 961, 2001, 701, 1474, 3664, 2125,
+    2357, 3072, 3467, 2617, 3493, 3048, 340, 2315, 2272, 2829, 2876, 289, 3012, 3819, 690, 606,
+    875, 3140, 3198, 762, 2181, 3248, 2194, 2938, 2350, 678, 438, 2173, 3091, 1224, 2376, 1323,
+    2916, 3307, 237, 3569, 2458, 924, 3899, 1266, 1281, 3517, 3079, 1981, 1208, 3499, 3785, 3662,
+    2095, 3522, 3149, 3035, 1300, 2034, 2040, 1963, 778, 331, 253, 1598, 2256, 1146, 1833, 2649,
+    1325, 3257, 3258, 1356, 1403, 2555, 3245, 2994, 488, 898, 3828, 835, 677, 1570, 2437, 1134,
+    1176, 648, 1617, 2116, 2762, 2875, 1089, 48, 1164, 552, 1022, 3345, 3246, 1584, 176, 2713,
+    1442, 2513, 1304, 3500, 2783, 529, 3913, 2766, 1904, 3738, 313, 3977, 3839, 1413, 3908, 1756,
+    3986, 3800, 1359, 3015, 3380, 520, 3164, 2971, 1206, 2869, 357, 86, 706, 1282, 2864, 2486,
+    1876, 3838, 3439, 2694, 692, 1396, 2761, 3143, 1744, 2185, 1026, 3699, 3885, 3858, 2811, 554,
+    3949, 1656, 1914, 3090, 3124, 2375, 1061, 1316, 2998, 3940, 630, 2965, 662, 3678, 3217, 1175,
+    2057, 2306, 109, 867, 2109, 528, 1324, 936, 699, 2264, 933, 1546, 1690, 667, 465, 1607,
+    2561, 3873, 3706, 3648, 1909, 107, 2395, 650, 1369, 3384, 3630, 1360, 411, 2325, 912, 366,
+    423, 2262, 352, 1599, 2408, 2819, 2722, 1975, 2471, 946, 3056, 624, 3326, 2274, 829, 1373,
+    225, 3328, 1532, 1799, 1380, 2865, 2235, 3541, 3427, 1773, 3070, 963, 992, 49, 1917, 302,
+    2991, 319, 1104, 2770, 3593, 2149, 72, 3200, 403, 3915, 1552, 1575, 345, 1226, 1653, 3441,
+    1411, 3278, 2993, 1548, 1699, 3189, 843, 1701, 1675, 80, 3196, 1037, 397, 1562, 1171, 2917,
+    1860, 2648, 747, 1979, 475, 2792, 3527, 441, 2117, 453, 2724, 3218, 1334, 1158, 3505, 2808,
+    1537, 2851, 956, 958, 1762, 2122, 888, 290, 668, 3361, 3325, 3508, 964, 2460, 2549, 84,
+    3280, 1444, 3216, 487, 2531, 492, 1931, 1825, 1566, 3064, 3073, 2836, 2136, 2597, 1678, 784,
+    2070, 3434, 2290, 1097, 3822, 1459, 2457, 416, 2567, 1008, 2769, 2335, 3663, 3803, 2189, 2168,
+    3760, 539, 2215, 1941, 766, 1728, 1676, 3080, 2915, 1771, 1250, 3982, 1517, 34, 3888, 2914,
+    2759, 1657, 3744, 820, 1619, 3559, 3071, 3316, 1935, 91, 1866, 420, 1616, 776, 2115, 335,
+    1143, 254, 1430, 484, 2675, 925, 1638, 2161, 3009, 532, 1706, 1673, 841, 837, 2401, 2833,
+    952, 1358, 200, 485, 457, 3476, 3241, 3259, 2855, 3516, 2563, 1791, 1716, 560, 136, 926,
+    1609, 1508, 2912, 2524, 1580, 3827, 562, 1187, 3297, 2562, 1512, 3671, 2017, 429, 1035, 2444,
+    3029, 585, 1583, 811, 2634, 3824, 3617, 3750, 1435, 3683, 3518, 103, 2330, 3130, 3260, 3503,
+    220, 2366, 886, 2080, 3041, 2671, 2964, 3023, 1475, 1721, 3990, 369, 1693, 3861, 249, 1370,
+    1310, 3737, 1611, 859, 2320, 2972, 3078, 223, 3853, 3272, 1270, 3475, 3252, 2677, 2140, 2073,
+    3782, 1320, 2962, 1271, 1421, 3304, 3843, 959, 2992, 3656, 3428, 3342, 976, 3969, 3235, 1133,
+    3444, 821, 3811, 2578, 477, 1715, 3359, 3730, 2137, 3348, 3772, 614, 1410, 870, 3882, 3006,
+    3288, 836, 2771, 3752, 3255, 3447, 2447, 451, 1625, 2204, 3412, 1684, 2488, 3409, 2790, 3172,
+    1002, 3318, 2599, 1106, 1391, 3951, 3761, 1890, 3187, 3502, 98, 3283, 2743, 2595, 3115, 768,
+    3618, 2419, 3633, 1452, 2644, 1608, 1154, 3042, 1415, 1958, 3465, 938, 2585, 3725, 718, 2517,
+    862, 3084, 2289, 2903, 1603, 1818, 3850, 3209, 2987, 430, 1194, 3886, 3758, 1594, 1626, 1377,
+    3456, 2405, 3097, 456, 3807, 3831, 3788, 210, 883, 3762, 2385, 3234, 1397, 392, 1404, 3014,
+    1064, 140, 771, 121, 923, 1541, 1524, 242, 387, 1472, 675, 2175, 1719, 1733, 1322, 3646,
+    3713, 3786, 576, 2159, 663, 3116, 1306, 408, 3036, 1232, 1439, 2465, 138, 2154, 1627, 2074,
+    2003, 3445, 1243, 3740, 842, 1321, 3616, 2031, 2919, 252, 3601, 1394, 1422, 169, 3623, 265,
+    1434, 478, 1094, 2099, 13, 4, 53, 2526, 2525, 2680, 75, 2100, 77, 742, 2882, 50,
+    1781, 71, 2784, 177, 1510, 2156, 95, 3596, 55, 2831, 2732, 311, 204, 305, 588, 144,
+    769, 673, 3365, 934, 1764, 26, 3145, 3905, 1961, 1505, 1796, 158, 32, 139, 231, 468,
+    450, 3697, 3554, 350, 3128, 1241, 1989, 1460, 1520, 184, 988, 2643, 2637, 1489, 1298, 1720,
+    2538, 153, 39, 446, 3869, 2726, 3971, 218, 111, 490, 85, 1832, 1313, 2565, 6, 1120,
+    401, 3741, 354, 367, 2528, 278, 1427, 102, 1455, 910, 3443, 1713, 2238, 3355, 3707, 3501,
+    694, 2979, 2010, 1100, 1503, 1219, 848, 3724, 3151, 1494, 1663, 1529, 2247, 2368, 2977, 2398,
+    1174, 2169, 2609, 2860, 2269, 1159, 1780, 2147, 2164, 2399, 3783, 2545, 2504, 1144, 3733, 3910,
+    1669, 931, 1590, 3273, 131, 1446, 436, 1804, 2478, 740, 293, 3984, 1629, 1858, 1814, 3381,
+    770, 471, 1944, 572, 2348, 2621, 2464, 3564, 593, 2082, 2900, 2004, 1506, 1029, 1736, 1795,
+    2518, 1936, 196, 995, 2467, 2768, 1530, 2246, 1087, 1205, 1841, 1560, 2891, 2901, 2284, 2902,
+    2281, 1840, 2961, 324, 2892, 203, 601, 755, 974, 3994, 1561, 2924, 3405, 973, 1309, 1287,
+    818, 2121, 1315, 1881, 2806, 3635, 1493, 2072, 2909, 3661, 2228, 2985, 1902, 1950, 3419, 2321,
+    2832, 751, 3353, 2820, 586, 3879, 1257, 130, 3420, 1131, 2265, 3261, 3177, 1704, 2267, 1559,
+    2407, 1057, 1116, 443, 2332, 1297, 1083, 3366, 3160, 1593, 1819, 1042, 2627, 3865, 3900, 1554,
+    2861, 2032, 885, 1811, 3205, 813, 1501, 772, 1406, 426, 1161, 3914, 2556, 2028, 3574, 1991,
+    2557, 900, 2331, 3852, 2165, 2703, 342, 2710, 519, 3622, 2334, 1497, 1351, 1533, 3133, 953,
+    127, 100, 3790, 1794, 2144, 108, 421, 3105, 3002, 3759, 3814, 1934, 1215, 3389, 3338, 3228,
+    2162, 3636, 2885, 3449, 1717, 2827, 927, 2884, 3102, 982, 807, 2613, 3039, 3845, 556, 1565,
+    3570, 1801, 2176, 2201, 3766, 2446, 3547, 3043, 2659, 533, 479, 1060, 3364, 47, 1182, 1308,
+    1408, 306, 3848, 329, 3513, 431, 226, 2642, 2252, 62, 3610, 1093, 2411, 1770, 1604, 3352,
+    2174, 647, 2360, 2426, 1589, 2594, 858, 299, 3720, 2922, 2313, 2813, 649, 3461, 1098, 1668,
+    2785, 1229, 391, 74, 2440, 644, 3689, 3320, 93, 1178, 2601, 36, 2873, 68, 2056, 104,
+    906, 929, 1605, 2630, 2520, 540, 58, 2329, 343, 1418, 255, 2606, 3581, 2383, 3602, 2369,
+    557, 3027, 66, 712, 3847, 318, 1956, 219, 105, 1151, 2326, 1341, 243, 447, 3586, 1615,
+    35, 3033, 1014, 3303, 2550, 834, 326, 1135, 860, 838, 3082, 1217, 806, 2704, 1103, 1613,
+    2089, 2341, 1021, 3334, 894, 661, 1467, 1951, 373, 2837, 1246, 396, 3728, 21, 3627, 761,
+    1800, 3005, 285, 228, 1346, 994, 3179, 1183, 653, 1601, 1977, 893, 209, 2012, 1515, 622,
+    991, 2333, 3798, 2449, 2166, 2340, 1200, 957, 1636, 2422, 197, 232, 966, 509, 2862, 3159,
+    167, 2461, 2720, 3061, 3981, 2142, 697, 689, 608, 789, 783, 3026, 65, 1488, 1522, 2217,
+    1900, 3970, 3556, 1596, 1340, 1260, 719, 412, 3957, 1076, 913, 371, 3506, 1531, 2048, 2101,
+    605, 817, 760, 1374, 1751, 853, 1169, 1099, 3473, 2775, 1476, 2429, 604, 2410, 106, 2779,
+    3488, 3691, 1749, 1393, 384, 3778, 737, 14, 207, 2647, 31, 414, 328, 3546, 3250, 2244,
+};
@@ -0,0 +1,17 @@
+// Generated by tools/gen_vocab.py from vocab_data_word.h - do not edit.
+#ifndef VOCAB_POOL_H
+#define VOCAB_POOL_H
+
+#include <stdint.h>
+
+#define VOCAB_COUNT 4000
+#define VOCAB_POOL_BYTES 28255
+
+// 32-bit whatever the pool size, the layout model containers use too
+typedef uint32_t vocab_offset_t;
+
+extern const char VOCAB_POOL[VOCAB_POOL_BYTES];
+extern const vocab_offset_t VOCAB_OFFSETS[VOCAB_COUNT + 1];
+extern const uint16_t VOCAB_SORTED[VOCAB_COUNT];
+
+#endif // VOCAB_POOL_H
@@ -0,0 +1,344 @@
+"""Compile the exported model into a device-ready model container.
+
+pack_model.py stores the Keras export as it is. This also optimizes it,
+reproducibly, into the container the firmware maps from flash:
+
+    python3 tools/compile_model.py --sample prompts.txt \\
+        --quantize dense=int8 --quantize lstm=fp16 --prune-units 224
+
+Layout (--layout): "interleaved" (the default) stores the LSTM weights
+with each unit's four gates side by side, as the fused LSTM kernel reads
+them, so the firmware uses them in place instead of repacking 1.3 MB into
+PSRAM at boot. "keras" keeps the export layout. The dense head is stored
+hidden-unit-major (units x vocab) either way: that is the order the dense
+kernel streams it in, one row per hidden unit, so it needs no transpose.
+
+Quantization (--quantize GROUP=TYPE, repeatable): GROUP is embedding,
+lstm, dense or all; TYPE is fp32, fp16, int8 or int4. int8 and int4 are
+symmetric with one scale per row. The firmware expands quantized tensors
+into PSRAM floats at boot, so they shrink the flash image and the upload,
+not the RAM. With interleaved LSTM weights the Keras lstm_kernel, which
+the seed prefill still reads, is stored as float but holds the same
+quantized values, so prefill and generation steps agree.
+
+Calibration (--sample): a text file with one prompt per line, tokenized
+as the firmware does. The float model is run over up to --max-prompts of
+them and its next-word distributions kept as the reference. For int8 and
+int4 each group's clipping range is chosen from CLIP_CANDIDATES by what
+disturbs those distributions least. Without a sample the full range is
+used and only weight errors are reported.
+
+Compression (--compress): deflates the weight tensors (embedding, LSTM
+and dense kernels) where that makes them smaller. Quantized values
+compress well, float ones barely. The firmware inflates them straight
+into PSRAM at boot through a 32 KB window, so this too saves flash and
+upload time, not RAM; the boot log shows how long it took and how much
+it saved.
+
+Pruning (--prune-units N, needs --sample): keeps the N LSTM units that
+matter most on the sample (mean |h| times the norm of the unit's dense
+row), shrinking every LSTM and dense product to match. N must be a
+multiple of 16, as the firmware requires of every model.
+
+A report follows with every tensor's size and error: the relative RMS
+error of its weights and, with a sample, the mean KL divergence and
+top-1 agreement of the next-word distributions with only that group
+changed, then of the whole compiled model. Flash the container as in
+pack_model.py. Needs numpy.
+"""
+
+import argparse
+import os
+
+import numpy as np
+
+from pack_model import (DTYPE_I4, DTYPE_I8, LAYOUT_GATE_INTERLEAVED, LSTM_UNITS,
+                        LSTM_UNITS_MULTIPLE, SEQ_LENGTH, compressed, pack, pq_tensors, read_arrays, tensor, vocab_tensors)
+from prune_vocab import EMBEDDING_DIM, SRC_DIR, read_vocab, tokenize
+
+TOKEN_UNK = 1
+GROUPS = ("embedding", "lstm", "dense")
+TYPES = ("fp32", "fp16", "int8", "int4")
+QMAX = {"int8": 127, "int4": 7}
+CLIP_CANDIDATES = (1.0, 0.9, 0.8, 0.7, 0.6)  # Fractions of each row's largest |weight|
+DTYPE_NAMES = {0: "fp32", 4: "int8", 5: "fp16", 6: "int4"}
+COMPRESSIBLE = ("embedding", "lstm_kernel", "lstm_recurrent", "lstm_fused", "dense_kernel")
+
+
+def sigmoid(x):
+    return 1.0 / (1.0 + np.exp(-x))
+
+
+def run(model, prompts):
+    # The next-word logits after every token of every prompt, and the
+    # hidden states they came from; all prompts are stepped together
+    units = model["recurrent"].shape[0]
+    lengths = np.array([len(p) for p in prompts])
+    tokens = np.zeros((len(prompts), lengths.max()), dtype=np.int64)
+    for i, p in enumerate(prompts):
+        tokens[i, :len(p)] = p
+    h = np.zeros((len(prompts), units), dtype=np.float32)
+    c = np.zeros_like(h)
+    states = []
+    for t in range(tokens.shape[1]):
+        z = model["embedding"][tokens[:, t]] @ model["kernel"] + h @ model["recurrent"] + model["bias"]
+        i, f, g, o = np.split(z, 4, axis=1)  # Keras gate order
+        c = sigmoid(f) * c + sigmoid(i) * np.tanh(g)
+        h = sigmoid(o) * np.tanh(c)
+        states.append(h[lengths > t])
+    states = np.concatenate(states)
+    return states @ model["dense"] + model["dense_bias"], states
+
+
+def log_softmax(logits):
+    shifted = logits - logits.max(axis=1, keepdims=True)
+    return shifted - np.log(np.exp(shifted).sum(axis=1, keepdims=True))
+
+
+def compare(reference, logits):
+    # Mean KL(reference || compiled) and how often the likeliest word agrees
+    ref = log_softmax(reference)
+    kl = (np.exp(ref) * (ref - log_softmax(logits))).sum(axis=1).mean()
+    top1 = (reference.argmax(axis=1) == logits.argmax(axis=1)).mean()
+    return kl, top1
+
+
+def quantize(weights, qtype, clip=1.0):
+    # Returns the values the firmware will compute with, and what is
+    # stored: (dtype code or None for numpy's, stored array, per-row scales)
+    if qtype == "fp32":
+        return weights, (None, weights, None)
+    if qtype == "fp16":
+        stored = weights.astype(np.float16)
+        return stored.astype(np.float32), (None, stored, None)
+    qmax = QMAX[qtype]
+    amax = np.abs(weights).max(axis=1) * clip
+    scales = np.where(amax > 0, amax / qmax, 1.0).astype(np.float32)
+    q = np.clip(np.round(weights / scales[:, None]), -qmax, qmax).astype(np.int8)
+    return q * scales[:, None], (DTYPE_I8 if qtype == "int8" else DTYPE_I4, q, scales)
+
+
+def stored_tensors(name, layout, stored_form):
+    # The tensor plus, for int8/int4, its per-row scales
+    dtype, stored, scales = stored_form
+    if dtype is None:
+        return [tensor(name, stored, layout)]
+    if dtype == DTYPE_I4:
+        nibbles = (stored.ravel().astype(np.uint8) & 0xF)
+        if len(nibbles) % 2:
+            nibbles = np.append(nibbles, 0)
+        data = (nibbles[0::2] | nibbles[1::2] << 4).astype(np.uint8).tobytes()
+        main = tensor(name, stored, layout, dtype=DTYPE_I4, data=data)
+    else:
+        main = tensor(name, stored, layout)
+    return [main, tensor(name + "_scale", scales)]
+
+
+def interleave(kernel, recurrent, bias):
+    # As DogberryAI_Word::packLstmWeights: unit k's row holds the i, f, c
+    # and o weights of every input, then of every recurrent input
+    units = recurrent.shape[0]
+    k = kernel.reshape(EMBEDDING_DIM, 4, units).transpose(2, 0, 1).reshape(units, -1)
+    r = recurrent.reshape(units, 4, units).transpose(2, 0, 1).reshape(units, -1)
+    return np.concatenate([k, r], axis=1), bias.reshape(4, units).T.copy()
+
+
+def deinterleave(fused, units):
+    k = fused[:, :EMBEDDING_DIM * 4].reshape(units, EMBEDDING_DIM, 4).transpose(1, 2, 0)
+    r = fused[:, EMBEDDING_DIM * 4:].reshape(units, units, 4).transpose(1, 2, 0)
+    return k.reshape(EMBEDDING_DIM, 4 * units), r.reshape(units, 4 * units)
+
+
+def prune_units(model, keep, states):
+    importance = np.abs(states).mean(axis=0) * np.linalg.norm(model["dense"], axis=1)
+    units = len(importance)
+    kept = np.sort(np.argsort(-importance)[:keep])
+    gate_cols = np.concatenate([g * units + kept for g in range(4)])
+    pruned = dict(model)
+    pruned["kernel"] = model["kernel"][:, gate_cols]
+    pruned["recurrent"] = model["recurrent"][kept][:, gate_cols]
+    pruned["bias"] = model["bias"][gate_cols]
+    pruned["dense"] = model["dense"][kept]
+    return pruned, importance[kept].sum() / importance.sum()
+
+
+def compile_group(model, group, qtype, interleaved, prompts, reference):
+    # Quantizes one group at the clipping that disturbs the calibration
+    # distributions least; returns the model as the firmware will see it,
+    # the tensors to store and the chosen clip
+    clips = CLIP_CANDIDATES if qtype in QMAX and prompts else (1.0,)
+    best = None
+    for clip in clips:
+        compiled = dict(model)
+        if group == "embedding":
+            compiled["embedding"], stored = quantize(model["embedding"], qtype, clip)
+            tensors = stored_tensors("embedding", 0, stored)
+        elif group == "dense":
+            compiled["dense"], stored = quantize(model["dense"], qtype, clip)
+            tensors = stored_tensors("dense_kernel", 0, stored)
+        elif interleaved:
+            fused, fused_bias = interleave(model["kernel"], model["recurrent"], model["bias"])
+            values, stored = quantize(fused, qtype, clip)
+            units = model["recurrent"].shape[0]
+            compiled["kernel"], compiled["recurrent"] = deinterleave(values, units)
+            tensors = (stored_tensors("lstm_fused", LAYOUT_GATE_INTERLEAVED, stored)
+                       + [tensor("lstm_fused_bias", fused_bias, LAYOUT_GATE_INTERLEAVED),
+                          tensor("lstm_kernel", compiled["kernel"].astype(np.float32))])
+        else:
+            compiled["kernel"], stored_k = quantize(model["kernel"], qtype, clip)
+            compiled["recurrent"], stored_r = quantize(model["recurrent"], qtype, clip)
+            tensors = (stored_tensors("lstm_kernel", 0, stored_k)
+                       + stored_tensors("lstm_recurrent", 0, stored_r))
+        kl = compare(reference, run(compiled, prompts)[0])[0] if len(clips) > 1 else 0.0
+        if best is None or kl < best[0]:
+            best = (kl, compiled, tensors, clip)
+    return best[1], best[2], best[3]
+
+
+def weight_error(original, compiled):
+    return np.sqrt(((compiled - original) ** 2).mean() / max((original ** 2).mean(), 1e-30))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--weights", default=os.path.join(SRC_DIR, "model_weights_word.h"))
+    parser.add_argument("--vocab", default=os.path.join(SRC_DIR, "vocab_data_word.h"))
+    parser.add_argument("--pq", default=os.path.join(SRC_DIR, "model_embedding_pq.h"),
+                        help="PQ embeddings header, used if it exists")
+    parser.add_argument("--sample", help="calibration prompts, one per line")
+    parser.add_argument("--max-prompts", type=int, default=64)
+    parser.add_argument("--layout", choices=("interleaved", "keras"), default="interleaved")
+    parser.add_argument("--quantize", action="append", default=[], metavar="GROUP=TYPE")
+    parser.add_argument("--prune-units", type=int, default=0)
+    parser.add_argument("--compress", action="store_true", help="deflate the weight tensors")
+    parser.add_argument("--name", default="full", help="model name shown at boot (15 bytes)")
+    parser.add_argument("--out", default="model.bin")
+    args = parser.parse_args()
+
+    qtypes = dict.fromkeys(GROUPS, "fp32")
+    for spec in args.quantize:
+        group, _, qtype = spec.partition("=")
+        if group not in GROUPS + ("all",) or qtype not in TYPES:
+            raise SystemExit("compile_model: --quantize wants GROUP=TYPE with GROUP in %s or all "
+                             "and TYPE in %s" % (", ".join(GROUPS), ", ".join(TYPES)))
+        for g in (GROUPS if group == "all" else (group,)):
+            qtypes[g] = qtype
+    use_pq = os.path.exists(args.pq)
+    if use_pq and any(spec.startswith("embedding=") for spec in args.quantize):
+        raise SystemExit("compile_model: the embeddings are product-quantized already (%s)" % args.pq)
+
+    arrays, _ = read_arrays(args.weights)
+    words = read_vocab(args.vocab)
+    vocab_size = len(words)
+    units = len(arrays["LSTM_BIAS"]) // 4
+    if (units > LSTM_UNITS or units % LSTM_UNITS_MULTIPLE or
+            len(arrays["DENSE_BIAS"]) != vocab_size):
+        raise SystemExit("compile_model: weights do not match the vocabulary or LSTM_UNITS")
+    if use_pq:
+        # Decoded, so calibration sees the embeddings the firmware will
+        pq, defines = read_arrays(args.pq)
+        subspaces = defines["EMBEDDING_PQ_SUBSPACES"]
+        code_array = pq["EMBEDDING_PQ_CODES"].reshape(vocab_size, subspaces)
+        book = pq["EMBEDDING_PQ_CODEBOOK"].reshape(subspaces, defines["EMBEDDING_PQ_CENTROIDS"], -1)
+        embedding = np.concatenate([book[s][code_array[:, s]] for s in range(subspaces)], axis=1)
+    else:
+        embedding = arrays["EMBEDDING_WEIGHTS"].reshape(vocab_size, EMBEDDING_DIM)
+    original = {
+        "embedding": embedding,
+        "kernel": arrays["LSTM_KERNEL"].reshape(EMBEDDING_DIM, 4 * units),
+        "recurrent": arrays["LSTM_RECURRENT"].reshape(units, 4 * units),
+        "bias": arrays["LSTM_BIAS"],
+        "dense": arrays["DENSE_KERNEL"].reshape(units, vocab_size),
+        "dense_bias": arrays["DENSE_BIAS"],
+    }
+
+    prompts = []
+    if args.sample:
+        ids = {w.lower(): i for i, w in reversed(list(enumerate(words)))}
+        with open(args.sample, encoding="utf-8") as f:
+            lines = [line for line in f if tokenize(line)]
+        step = max(1, len(lines) // args.max_prompts)
+        for line in lines[::step][:args.max_prompts]:
+            prompts.append([ids.get(w, TOKEN_UNK) for w in tokenize(line)][:SEQ_LENGTH])
+    if args.prune_units and not prompts:
+        raise SystemExit("compile_model: --prune-units needs --sample")
+    if args.prune_units % LSTM_UNITS_MULTIPLE:
+        raise SystemExit("compile_model: --prune-units must be a multiple of %d"
+                         % LSTM_UNITS_MULTIPLE)
+
+    reference = None
+    model = original
+    if prompts:
+        reference, states = run(original, prompts)
+        print("Calibrating on %d prompts (%d next-word distributions)" % (len(prompts),
+                                                                          len(reference)))
+        if args.prune_units and args.prune_units < units:
+            model, kept = prune_units(original, args.prune_units, states)
+            units = args.prune_units
+            kl, top1 = compare(reference, run(model, prompts)[0])
+            print("Pruned to %d LSTM units, keeping %.1f%% of the importance: KL %.4f, "
+                  "top-1 %.1f%%" % (units, 100 * kept, kl, 100 * top1))
+
+    # Compile each group, scoring it alone against the (pruned) float model
+    interleaved = args.layout == "interleaved"
+    base = run(model, prompts)[0] if prompts else None
+    compiled = dict(model)
+    tensors = []
+    report = []
+    for group in GROUPS:
+        if group == "embedding" and use_pq:
+            for t in pq_tensors(args.pq, vocab_size):
+                report.append((t[0], "pq", t[6], len(t[4]), None))
+                tensors.append(t)
+            continue
+        alone, group_tensors, clip = compile_group(model, group, qtypes[group], interleaved,
+                                                   prompts, base)
+        keys = {"embedding": ("embedding",), "lstm": ("kernel", "recurrent"),
+                "dense": ("dense",)}[group]
+        for key in keys:
+            compiled[key] = alone[key]
+        error = weight_error(np.concatenate([model[k].ravel() for k in keys]),
+                             np.concatenate([alone[k].ravel() for k in keys]))
+        scores = compare(base, run(alone, prompts)[0]) if prompts else None
+        if args.compress:
+            group_tensors = [compressed(t) if t[0] in COMPRESSIBLE else t for t in group_tensors]
+        for i, t in enumerate(group_tensors):
+            # The group's errors go on its first tensor
+            report.append((t[0], DTYPE_NAMES[t[1]], t[6], len(t[4]),
+                           (error, clip, scores) if i == 0 else None))
+        tensors += group_tensors
+    tensors += [tensor("lstm_bias", model["bias"]), tensor("dense_bias", model["dense_bias"])]
+    tensors += vocab_tensors(words)
+
+    container = pack(args.name, vocab_size, units, tensors)
+    with open(args.out, "wb") as f:
+        f.write(container)
+
+    # Report
+    print("%-22s %-5s %9s %9s %9s %5s %8s %7s" % ("tensor", "type", "bytes", "stored", "rel.err",
+                                                  "clip", "KL", "top-1"))
+    for name, qtype, size, stored, errors in report:
+        line = "%-22s %-5s %9d %9d" % (name, qtype, size, stored)
+        if errors:
+            error, clip, scores = errors
+            line += " %9.5f %5.2f" % (error, clip)
+            if scores:
+                line += " %8.5f %6.1f%%" % (scores[0], 100 * scores[1])
+        print(line)
+    float_bytes = sum(a.nbytes for a in original.values())
+    print("Compiled: %d KB of weights -> %d KB container (%s layout, %d LSTM units)" % (
+        float_bytes // 1024, len(container) // 1024, args.layout, units))
+    if args.compress:
+        raw = sum(t[6] for t in tensors)
+        stored = sum(len(t[4]) for t in tensors)
+        print("Compression saved %d KB of flash (%d KB of tensors stored in %d KB)" % (
+            (raw - stored) // 1024, raw // 1024, stored // 1024))
+    if prompts:
+        kl, top1 = compare(reference, run(compiled, prompts)[0])
+        print("Whole model against the float export: KL %.5f, top-1 agreement %.1f%%" % (
+            kl, 100 * top1))
+    print("Wrote %s" % os.path.abspath(args.out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,126 @@
+"""Generate the packed vocabulary tables from vocab_data_word.h.
+
+vocab_data_word.h is what the training export produces: an array of
+pointers, one string per word. The firmware does not compile it directly;
+instead this script writes
+
+    src/vocab_pool_word.h    declarations, safe to include anywhere
+    src/vocab_pool_word.cpp  the data, stored in flash:
+        VOCAB_POOL     every word back to back, each NUL-terminated
+        VOCAB_OFFSETS  start of word i in the pool (VOCAB_COUNT + 1 entries,
+                       so length = VOCAB_OFFSETS[i + 1] - VOCAB_OFFSETS[i] - 1)
+        VOCAB_SORTED   ids ordered by strcmp() of their words, for binary search
+
+Runs as a PlatformIO pre-build script (see platformio.ini) and only
+rewrites the output when the vocabulary is newer. It can also be run by
+hand:
+
+    python3 tools/gen_vocab.py [--force]
+"""
+
+import os
+import re
+import sys
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__)) if "__file__" in globals() else None
+
+
+def project_dir():
+    try:
+        Import("env")  # noqa: F821 - provided by SCons when run from PlatformIO
+        return env["PROJECT_DIR"]  # noqa: F821
+    except NameError:
+        return os.path.dirname(TOOLS_DIR)
+
+
+def read_vocab(path):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    body = text[text.index("VOCAB_WORDS"):]
+    body = body[body.index("{") + 1:body.index("};")]
+    words = [re.sub(r"\\(.)", r"\1", w)
+             for w in re.findall(r'"((?:[^"\\]|\\.)*)"', body)]
+    return words
+
+
+def c_string(word, terminate=True):
+    text = word.replace("\\", "\\\\").replace('"', '\\"')
+    return '"' + text + ('\\0"' if terminate else '"')
+
+
+def write_tables(words, header_path, source_path):
+    encoded = [w.encode("utf-8") for w in words]
+    offsets = [0]
+    for w in encoded:
+        offsets.append(offsets[-1] + len(w) + 1)
+    order = sorted(range(len(words)), key=lambda i: encoded[i])
+
+    header = [
+        "// Generated by tools/gen_vocab.py from vocab_data_word.h - do not edit.",
+        "#ifndef VOCAB_POOL_H",
+        "#define VOCAB_POOL_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "#define VOCAB_COUNT %d" % len(words),
+        "#define VOCAB_POOL_BYTES %d" % offsets[-1],
+        "",
+        "// 32-bit whatever the pool size, the layout model containers use too",
+        "typedef uint32_t vocab_offset_t;",
+        "",
+        "extern const char VOCAB_POOL[VOCAB_POOL_BYTES];",
+        "extern const vocab_offset_t VOCAB_OFFSETS[VOCAB_COUNT + 1];",
+        "extern const uint16_t VOCAB_SORTED[VOCAB_COUNT];",
+        "",
+        "#endif // VOCAB_POOL_H",
+        "",
+    ]
+
+    source = [
+        "// Generated by tools/gen_vocab.py from vocab_data_word.h - do not edit.",
+        "#include <Arduino.h>",
+        '#include "vocab_pool_word.h"',
+        "",
+        "// All words, NUL-terminated, back to back",
+        "const char VOCAB_POOL[VOCAB_POOL_BYTES] PROGMEM =",
+    ]
+    for i, w in enumerate(words):
+        # The literal's own terminator ends the last word
+        last = i == len(words) - 1
+        source.append("    %s%s  // %d" % (c_string(w, not last), ";" if last else "", i))
+    source += ["", "// Start of each word in VOCAB_POOL, plus the end of the pool",
+               "const vocab_offset_t VOCAB_OFFSETS[VOCAB_COUNT + 1] PROGMEM = {"]
+    for start in range(0, len(offsets), 16):
+        source.append("    " + ", ".join(str(o) for o in offsets[start:start + 16]) + ",")
+    source += ["};", "", "// Vocabulary ids ordered by strcmp() of their words, for binary search",
+               "const uint16_t VOCAB_SORTED[VOCAB_COUNT] PROGMEM = {"]
+    for start in range(0, len(order), 16):
+        source.append("    " + ", ".join(str(i) for i in order[start:start + 16]) + ",")
+    source += ["};", ""]
+
+    with open(header_path, "w", encoding="utf-8") as f:
+        f.write("\n".join(header))
+    with open(source_path, "w", encoding="utf-8") as f:
+        f.write("\n".join(source))
+    return offsets[-1]
+
+
+def main():
+    src = os.path.join(project_dir(), "src")
+    vocab_path = os.path.join(src, "vocab_data_word.h")
+    header_path = os.path.join(src, "vocab_pool_word.h")
+    source_path = os.path.join(src, "vocab_pool_word.cpp")
+
+    if (os.path.exists(header_path) and os.path.exists(source_path)
+            and os.path.getmtime(source_path) >= os.path.getmtime(vocab_path)
+            and "--force" not in sys.argv):
+        return
+
+    words = read_vocab(vocab_path)
+    if len(set(words)) != len(words):
+        raise SystemExit("gen_vocab: duplicate words in vocabulary")
+    pool_bytes = write_tables(words, header_path, source_path)
+    print("gen_vocab: %d words, %d byte pool -> %s" % (len(words), pool_bytes, source_path))
+
+
+main()
@@ -0,0 +1,211 @@
+"""Minimal stand-in for the Bluesky XRPC endpoints the firmware uses.
+
+Serves a synthetic burst of mentions and measures how fast the bot
+answers them. Point the firmware at it from secrets.h:
+
+    #define BLUESKY_API_BASE "http://<this machine's IP>:8080/xrpc"
+
+then run
+
+    python3 tools/mock_bluesky.py [--port 8080] [--burst 20] [--followups 0]
+
+Every reply posted is logged; once the whole burst has been answered the
+replies/minute since the bot first listed it is printed. With --followups
+N, each reply from the bot is answered by the "user" until a thread has N
+follow-ups, which exercises the firmware's conversation state cache.
+Another burst can be queued at any time with
+
+    curl -X POST http://localhost:8080/mock/burst?count=20
+"""
+
+import argparse
+import datetime
+import json
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlparse
+
+MENTION_TEXTS = [
+    "@dogberry what is the watch for?",
+    "hello @dogberry",
+    "@dogberry help me find the villain",
+    "@dogberry you are a fool",
+    "@dogberry tell me of messina",
+]
+
+FOLLOW_UP_TEXTS = [
+    "@dogberry but why?",
+    "@dogberry and what of the prince?",
+    "@dogberry i do not follow",
+]
+
+DID = "did:plc:mockdogberry"
+
+
+class MockState:
+    def __init__(self, followups=0):
+        self.followups = followups
+        self.depth = {}          # Follow-ups so far, by thread root URI
+        self.lock = threading.Lock()
+        self.mentions = []       # Newest first, like listNotifications
+        self.seen_at = ""        # From updateSeen
+        self.last_indexed = None
+        self.replied = set()     # URIs that have a reply
+        self.next_id = 0
+        self.burst_size = 0
+        self.burst_listed = None  # When the bot first saw the current burst
+        self.burst_answered = 0
+
+    def add_post(self, reason, record):
+        # Caller holds the lock
+        i = self.next_id
+        self.next_id += 1
+        uri = "at://did:plc:mockuser/app.bsky.feed.post/%d" % i
+        # indexedAt as Bluesky formats it, strictly increasing
+        now = datetime.datetime.now(datetime.timezone.utc)
+        indexed = now.replace(tzinfo=None, microsecond=now.microsecond // 1000 * 1000)
+        if self.last_indexed and indexed <= self.last_indexed:
+            indexed = self.last_indexed + datetime.timedelta(milliseconds=1)
+        self.last_indexed = indexed
+        self.mentions.insert(0, {
+            "uri": uri,
+            "cid": "bafymock%d" % i,
+            "reason": reason,
+            "record": record,
+            "indexedAt": indexed.isoformat(timespec="milliseconds") + "Z",
+        })
+        return uri
+
+    def add_burst(self, count):
+        with self.lock:
+            for i in range(count):
+                self.add_post("mention", {"text": MENTION_TEXTS[i % len(MENTION_TEXTS)]})
+            self.burst_size = count
+            self.burst_listed = None
+            self.burst_answered = 0
+        print("Queued a burst of %d mentions" % count)
+
+    def list_notifications(self, limit, cursor):
+        # The cursor is just the offset of the next page
+        with self.lock:
+            pending = [m for m in self.mentions if m["uri"] not in self.replied]
+            if pending and self.burst_listed is None:
+                self.burst_listed = time.time()
+            start = int(cursor or 0)
+            page = [dict(m, isRead=m["indexedAt"] <= self.seen_at)
+                    for m in self.mentions[start:start + limit]]
+            more = start + limit < len(self.mentions)
+            return page, str(start + limit) if more else None
+
+    def update_seen(self, seen_at):
+        with self.lock:
+            self.seen_at = max(self.seen_at, seen_at)
+
+    def record_reply(self, record, reply_uri):
+        parent = record.get("reply", {}).get("parent", {}).get("uri")
+        root = record.get("reply", {}).get("root", {})
+        with self.lock:
+            if parent is None or parent in self.replied:
+                return
+            self.replied.add(parent)
+            self.burst_answered += 1
+
+            # The user answers back in the same thread
+            depth = self.depth.get(root.get("uri"), 0)
+            if depth < self.followups:
+                self.depth[root.get("uri")] = depth + 1
+                self.add_post("reply", {
+                    "text": FOLLOW_UP_TEXTS[depth % len(FOLLOW_UP_TEXTS)],
+                    "reply": {"root": root, "parent": {"uri": reply_uri, "cid": "bafyreply"}},
+                })
+                self.burst_size += 1
+
+            elapsed = time.time() - (self.burst_listed or time.time())
+            print("[%6.1f s] reply %d/%d to %s: %s" % (
+                elapsed, self.burst_answered, self.burst_size, parent, record.get("text")))
+            if self.burst_answered == self.burst_size:
+                rate = self.burst_size * 60.0 / elapsed if elapsed > 0 else 0.0
+                print("Burst of %d answered in %.1f s: %.1f replies/minute" % (
+                    self.burst_size, elapsed, rate))
+
+
+STATE = None
+
+
+class Handler(BaseHTTPRequestHandler):
+    def send_json(self, obj, code=200):
+        body = json.dumps(obj).encode("utf-8")
+        self.send_response(code)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    def read_json(self):
+        length = int(self.headers.get("Content-Length", 0))
+        return json.loads(self.rfile.read(length) or b"{}")
+
+    def do_GET(self):
+        url = urlparse(self.path)
+        query = parse_qs(url.query)
+        if url.path == "/xrpc/app.bsky.notification.listNotifications":
+            limit = int(query.get("limit", ["50"])[0])
+            page, cursor = STATE.list_notifications(limit, query.get("cursor", [None])[0])
+            response = {"notifications": page}
+            if cursor:
+                response["cursor"] = cursor
+            self.send_json(response)
+        else:
+            self.send_json({"error": "NotFound"}, 404)
+
+    def do_POST(self):
+        url = urlparse(self.path)
+        if url.path == "/xrpc/com.atproto.server.createSession":
+            self.read_json()
+            self.send_json({"accessJwt": "mock-jwt", "did": DID})
+        elif url.path == "/xrpc/app.bsky.notification.updateSeen":
+            STATE.update_seen(self.read_json().get("seenAt", ""))
+            self.send_response(200)
+            self.send_header("Content-Length", "0")
+            self.end_headers()
+        elif url.path == "/xrpc/com.atproto.repo.createRecord":
+            record = self.read_json().get("record", {})
+            uri = "at://%s/app.bsky.feed.post/%d" % (DID, time.monotonic_ns())
+            if "reply" in record:
+                STATE.record_reply(record, uri)
+            else:
+                print("Status posted: %s" % record.get("text"))
+            self.send_json({"uri": uri, "cid": "bafyreply"})
+        elif url.path == "/mock/burst":
+            count = int(parse_qs(url.query).get("count", ["20"])[0])
+            STATE.add_burst(count)
+            self.send_json({"queued": count})
+        else:
+            self.send_json({"error": "NotFound"}, 404)
+
+    def log_message(self, fmt, *args):
+        pass  # Replies are logged by MockState instead
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--burst", type=int, default=20,
+                        help="mentions queued at startup")
+    parser.add_argument("--followups", type=int, default=0,
+                        help="follow-up replies per thread")
+    args = parser.parse_args()
+
+    global STATE
+    STATE = MockState(args.followups)
+
+    if args.burst > 0:
+        STATE.add_burst(args.burst)
+    server = ThreadingHTTPServer(("0.0.0.0", args.port), Handler)
+    print("Mock Bluesky listening on port %d" % args.port)
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
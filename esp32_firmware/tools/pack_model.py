@@ -0,0 +1,188 @@
+"""Pack the model and its vocabulary into a binary model container.
+
+Firmware built from the lilygo-t-display-s3-container environment has no
+model compiled in; it memory-maps one from the "model" flash partition
+(see ModelContainer.h for the format). This writes that container from
+the usual exports:
+
+    python3 tools/pack_model.py [--out model.bin] [--name full]
+
+reading src/model_weights_word.h, src/vocab_data_word.h and, if present,
+src/model_embedding_pq.h (whose product-quantized embeddings then replace
+EMBEDDING_WEIGHTS, as in compiled-in builds). Flash it to the partition
+without rebuilding the firmware:
+
+    python3 -m esptool --chip esp32s3 write_flash 0x610000 model.bin
+
+(0x610000 is the model partition's offset in partitions_container.csv.)
+compile_model.py writes the same kind of container with the weights
+optimized for the device.
+"""
+
+import argparse
+import os
+import re
+import struct
+import zlib
+
+import numpy as np
+
+from prune_vocab import EMBEDDING_DIM, FLOAT_ARRAY, FLOAT_VALUE, SRC_DIR, read_vocab
+
+# Must match ModelContainer.h
+CONTAINER_MAGIC = 0x4D424744
+CONTAINER_VERSION = 2
+CONTAINER_ALIGN = 16
+CONTAINER_MAX_TENSORS = 24
+SEQ_LENGTH = 40
+LSTM_UNITS = 256
+LSTM_UNITS_MULTIPLE = 16
+DTYPES = {np.dtype(np.float32): 0, np.dtype(np.uint8): 1, np.dtype(np.uint16): 2,
+          np.dtype(np.uint32): 3, np.dtype(np.int8): 4, np.dtype(np.float16): 5}
+DTYPE_I8 = 4
+DTYPE_I4 = 6
+LAYOUT_ROW_MAJOR = 0
+LAYOUT_GATE_INTERLEAVED = 1
+CODEC_NONE = 0
+CODEC_DEFLATE = 1
+
+HEADER = struct.Struct("<IHHII16sHHHH24x")
+TENSOR = struct.Struct("<24sBBBB3III fiI4x")
+BYTE_ARRAY = re.compile(r"const\s+uint8_t\s+(?P<name>\w+)\s*\[[^\]]*\]\s*(?:PROGMEM\s*)?=\s*\{"
+                        r"(?P<body>.*?)\};", re.S)
+
+
+def read_arrays(path):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    arrays = {}
+    for m in FLOAT_ARRAY.finditer(text):
+        arrays[m.group("name")] = np.array(
+            [float(v) for v in FLOAT_VALUE.findall(m.group("body"))], dtype=np.float32)
+    for m in BYTE_ARRAY.finditer(text):
+        arrays[m.group("name")] = np.array(
+            [int(v) for v in re.findall(r"\d+", m.group("body"))], dtype=np.uint8)
+    defines = {m.group(1): int(m.group(2))
+               for m in re.finditer(r"#define\s+(\w+)\s+(\d+)", text)}
+    return arrays, defines
+
+
+def vocab_tables(words):
+    # Same tables as gen_vocab.py writes to vocab_pool_word.cpp
+    encoded = [w.encode("utf-8") for w in words]
+    pool = b"".join(w + b"\0" for w in encoded)
+    offsets = [0]
+    for w in encoded:
+        offsets.append(offsets[-1] + len(w) + 1)
+    order = sorted(range(len(words)), key=lambda i: encoded[i])
+    return (np.frombuffer(pool, dtype=np.uint8), np.array(offsets, dtype=np.uint32),
+            np.array(order, dtype=np.uint16))
+
+
+def vocab_tensors(words):
+    pool, offsets, order = vocab_tables(words)
+    return [tensor("vocab_pool", pool), tensor("vocab_offsets", offsets),
+            tensor("vocab_sorted", order)]
+
+
+def pq_tensors(path, vocab_size):
+    pq, defines = read_arrays(path)
+    subspaces = defines["EMBEDDING_PQ_SUBSPACES"]
+    centroids = defines["EMBEDDING_PQ_CENTROIDS"]
+    return [
+        tensor("embedding_pq_codes", pq["EMBEDDING_PQ_CODES"].reshape(vocab_size, subspaces)),
+        tensor("embedding_pq_codebook", pq["EMBEDDING_PQ_CODEBOOK"].reshape(
+            subspaces, centroids, EMBEDDING_DIM // subspaces)),
+    ]
+
+
+def tensor(name, array, layout=LAYOUT_ROW_MAJOR, dtype=None, data=None):
+    # One container tensor, shaped as the firmware expects. Packed types
+    # with no numpy equivalent (int4) pass their dtype and bytes.
+    if len(name.encode()) >= 24:
+        raise SystemExit("pack_model: tensor name %s is too long" % name)
+    if data is None:
+        data = np.ascontiguousarray(array).astype(array.dtype.newbyteorder("<")).tobytes()
+    return (name, DTYPES[array.dtype] if dtype is None else dtype, layout, array.shape, data,
+            CODEC_NONE, len(data))
+
+
+def compressed(t):
+    # The tensor deflated, if that makes it smaller. The firmware inflates
+    # it into PSRAM at boot, so only use this on the weights it reads as
+    # floats (not scales, PQ codes or the vocabulary).
+    data = zlib.compress(t[4], 9)
+    if len(data) >= len(t[4]):
+        return t
+    return t[:4] + (data, CODEC_DEFLATE, len(t[4]))
+
+
+def pack(name, vocab_size, units, tensors):
+    # tensors: tensor() or compressed() tuples in file order
+    if len(tensors) > CONTAINER_MAX_TENSORS:
+        raise SystemExit("pack_model: more than %d tensors" % CONTAINER_MAX_TENSORS)
+    offset = HEADER.size + len(tensors) * TENSOR.size
+    table = b""
+    data = b""
+    for tensor_name, dtype, layout, shape, tensor_data, codec, raw_bytes in tensors:
+        pad = -(offset + len(data)) % CONTAINER_ALIGN
+        data += b"\0" * pad
+        dims = list(shape) + [0] * (3 - len(shape))
+        table += TENSOR.pack(tensor_name.encode(), dtype, layout, len(shape), codec, *dims,
+                             offset + len(data), len(tensor_data), 1.0, 0,
+                             raw_bytes if codec else 0)
+        data += tensor_data
+    body = table + data
+    header = HEADER.pack(CONTAINER_MAGIC, CONTAINER_VERSION, len(tensors), HEADER.size + len(body),
+                         zlib.crc32(body), name.encode()[:15], vocab_size, EMBEDDING_DIM, units,
+                         SEQ_LENGTH)
+    return header + body
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--weights", default=os.path.join(SRC_DIR, "model_weights_word.h"))
+    parser.add_argument("--vocab", default=os.path.join(SRC_DIR, "vocab_data_word.h"))
+    parser.add_argument("--pq", default=os.path.join(SRC_DIR, "model_embedding_pq.h"),
+                        help="PQ embeddings header, used if it exists")
+    parser.add_argument("--name", default="full", help="model name shown at boot (15 bytes)")
+    parser.add_argument("--out", default="model.bin")
+    args = parser.parse_args()
+
+    arrays, _ = read_arrays(args.weights)
+    for required in ("LSTM_KERNEL", "LSTM_RECURRENT", "LSTM_BIAS", "DENSE_KERNEL", "DENSE_BIAS"):
+        if required not in arrays:
+            raise SystemExit("pack_model: %s not found in %s" % (required, args.weights))
+    words = read_vocab(args.vocab)
+    vocab_size = len(words)
+    units = len(arrays["LSTM_BIAS"]) // 4
+    if (units > LSTM_UNITS or units % LSTM_UNITS_MULTIPLE or
+            len(arrays["DENSE_BIAS"]) != vocab_size):
+        raise SystemExit("pack_model: weights do not match the vocabulary or LSTM_UNITS")
+
+    tensors = [
+        tensor("lstm_kernel", arrays["LSTM_KERNEL"].reshape(EMBEDDING_DIM, 4 * units)),
+        tensor("lstm_recurrent", arrays["LSTM_RECURRENT"].reshape(units, 4 * units)),
+        tensor("lstm_bias", arrays["LSTM_BIAS"]),
+        tensor("dense_kernel", arrays["DENSE_KERNEL"].reshape(units, vocab_size)),
+        tensor("dense_bias", arrays["DENSE_BIAS"]),
+    ]
+    if os.path.exists(args.pq):
+        tensors += pq_tensors(args.pq, vocab_size)
+        embeddings = "PQ embeddings from %s" % os.path.basename(args.pq)
+    else:
+        tensors.append(tensor("embedding",
+                              arrays["EMBEDDING_WEIGHTS"].reshape(vocab_size, EMBEDDING_DIM)))
+        embeddings = "full-precision embeddings"
+    tensors += vocab_tensors(words)
+
+    container = pack(args.name, vocab_size, units, tensors)
+    with open(args.out, "wb") as f:
+        f.write(container)
+    print("%s: %d words, %d LSTM units, %s, %d tensors, %d KB" % (
+        args.name, vocab_size, units, embeddings, len(tensors), len(container) // 1024))
+    print("Wrote %s" % os.path.abspath(args.out))
+
+
+if __name__ == "__main__":
+    main()
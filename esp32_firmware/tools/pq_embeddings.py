@@ -0,0 +1,132 @@
+"""Product-quantize the embedding table.
+
+EMBEDDING_WEIGHTS holds EMBEDDING_DIM floats per word (1 MB for 4000
+words). This splits each embedding into --subspaces runs of dimensions,
+clusters every run with k-means into --centroids centroids, and stores a
+word as one byte per subspace naming its centroid:
+
+    python3 tools/pq_embeddings.py [--subspaces 8] [--centroids 256]
+
+writes src/model_embedding_pq.h with
+
+    EMBEDDING_PQ_CODEBOOK  [subspace][centroid][dimension] floats
+    EMBEDDING_PQ_CODES     [word][subspace] bytes
+
+With 8 x 256 that is 32 KB of codes plus a 64 KB codebook, which the
+firmware copies to internal SRAM. When the header is present the firmware
+decodes embeddings from it and EMBEDDING_WEIGHTS drops out of the build;
+delete it to go back to the full-precision table. The reconstruction error
+is reported so the loss can be weighed against the saving. Needs numpy.
+"""
+
+import argparse
+import os
+
+import numpy as np
+
+from prune_vocab import EMBEDDING_DIM, FLOAT_ARRAY, FLOAT_VALUE, SRC_DIR
+
+
+def read_embeddings(path):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    for m in FLOAT_ARRAY.finditer(text):
+        if m.group("name") == "EMBEDDING_WEIGHTS":
+            values = np.array([float(v) for v in FLOAT_VALUE.findall(m.group("body"))],
+                              dtype=np.float32)
+            return values.reshape(-1, EMBEDDING_DIM)
+    raise SystemExit("pq_embeddings: EMBEDDING_WEIGHTS not found in %s" % path)
+
+
+def kmeans(points, k, iterations, rng):
+    # Lloyd's algorithm from k distinct starting points; a centroid that
+    # loses all its points is moved to the worst-served point
+    centroids = points[rng.choice(len(points), k, replace=False)].copy()
+    for _ in range(iterations):
+        distances = ((points[:, None, :] - centroids[None, :, :]) ** 2).sum(axis=2)
+        assignment = distances.argmin(axis=1)
+        for c in range(k):
+            members = points[assignment == c]
+            if len(members) > 0:
+                centroids[c] = members.mean(axis=0)
+            else:
+                worst = distances[np.arange(len(points)), assignment].argmax()
+                centroids[c] = points[worst]
+                assignment[worst] = c
+    distances = ((points[:, None, :] - centroids[None, :, :]) ** 2).sum(axis=2)
+    return centroids, distances.argmin(axis=1)
+
+
+def c_array(values, fmt, per_line):
+    lines = []
+    for start in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in values[start:start + per_line]) + ",")
+    return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--weights", default=os.path.join(SRC_DIR, "model_weights_word.h"))
+    parser.add_argument("--out", default=os.path.join(SRC_DIR, "model_embedding_pq.h"))
+    parser.add_argument("--subspaces", type=int, default=8)
+    parser.add_argument("--centroids", type=int, default=256)
+    parser.add_argument("--iterations", type=int, default=25)
+    parser.add_argument("--seed", type=int, default=0)
+    args = parser.parse_args()
+
+    if EMBEDDING_DIM % args.subspaces != 0:
+        raise SystemExit("pq_embeddings: --subspaces must divide %d" % EMBEDDING_DIM)
+    if not 1 <= args.centroids <= 256:
+        raise SystemExit("pq_embeddings: codes are one byte, so --centroids is at most 256")
+
+    embeddings = read_embeddings(args.weights)
+    words = len(embeddings)
+    dims = EMBEDDING_DIM // args.subspaces
+    rng = np.random.default_rng(args.seed)
+
+    codebook = np.zeros((args.subspaces, args.centroids, dims), dtype=np.float32)
+    codes = np.zeros((words, args.subspaces), dtype=np.uint8)
+    for s in range(args.subspaces):
+        part = embeddings[:, s * dims:(s + 1) * dims]
+        codebook[s], codes[:, s] = kmeans(part, args.centroids, args.iterations, rng)
+
+    decoded = np.concatenate([codebook[s][codes[:, s]] for s in range(args.subspaces)], axis=1)
+
+    lines = [
+        "// Generated by tools/pq_embeddings.py from model_weights_word.h - do not edit.",
+        "#ifndef MODEL_EMBEDDING_PQ_H",
+        "#define MODEL_EMBEDDING_PQ_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "#define EMBEDDING_PQ_SUBSPACES %d" % args.subspaces,
+        "#define EMBEDDING_PQ_CENTROIDS %d" % args.centroids,
+        "",
+        "// Centroids of each subspace: [subspace][centroid][dimension]",
+        "const float EMBEDDING_PQ_CODEBOOK[%d] PROGMEM = {" % codebook.size,
+    ]
+    lines += c_array(codebook.ravel().tolist(), "%.8gf", 8)
+    lines += ["};", "", "// Each word's centroid in every subspace: [word][subspace]",
+              "const uint8_t EMBEDDING_PQ_CODES[%d] PROGMEM = {" % codes.size]
+    lines += c_array(codes.ravel().tolist(), "%d", 16)
+    lines += ["};", "", "#endif // MODEL_EMBEDDING_PQ_H", ""]
+    with open(args.out, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+
+    # Report
+    error = decoded - embeddings
+    norms = np.linalg.norm(embeddings, axis=1)
+    relative = np.linalg.norm(error, axis=1) / np.maximum(norms, 1e-12)
+    cosine = (decoded * embeddings).sum(axis=1) / np.maximum(
+        norms * np.linalg.norm(decoded, axis=1), 1e-12)
+    print("%d words: %d KB table -> %d KB codes + %d KB codebook" % (
+        words, embeddings.nbytes // 1024, codes.nbytes // 1024, codebook.nbytes // 1024))
+    print("RMS error %.4f (embedding RMS %.4f), max abs error %.4f" % (
+        np.sqrt((error ** 2).mean()), np.sqrt((embeddings ** 2).mean()), np.abs(error).max()))
+    print("Relative error: mean %.3f, worst %.3f; cosine similarity: mean %.4f, worst %.4f" % (
+        relative.mean(), relative.max(), cosine.mean(), cosine.min()))
+    print("Wrote %s" % os.path.abspath(args.out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,259 @@
+"""Drop words from the vocabulary and shrink the model to match.
+
+Every vocabulary entry costs LSTM_UNITS multiply-adds per generated token
+in the dense layer, plus its rows of EMBEDDING_WEIGHTS and DENSE_KERNEL
+in flash. This removes words the bot should never say or never needs:
+
+    python3 tools/prune_vocab.py --deny denylist.txt
+    python3 tools/prune_vocab.py --sample corpus.txt --min-count 3
+    python3 tools/prune_vocab.py --sample corpus.txt --keep 2500 --deny denylist.txt
+
+--deny drops the words listed in a file (one per line, # comments).
+--sample counts how often each word occurs in a text file, tokenized like
+the firmware does; --min-count then drops rarer words and --keep keeps
+only the most frequent ones. <PAD>, <UNK>, <START> and punctuation are
+always kept.
+
+The surviving words keep their relative order and are renumbered from 0.
+Their embedding rows, DENSE_KERNEL columns and DENSE_BIAS entries are
+copied across, and MODEL_VOCAB_SIZE is recorded in the weights header so
+the firmware can check the two files belong together. The cascade's fast
+model (src/model_weights_small.h, SMALL_* arrays), if present, shares the
+vocabulary and is pruned the same way; it must match the vocabulary being
+pruned. So do the product-quantized embeddings (src/model_embedding_pq.h),
+whose EMBEDDING_PQ_CODES rows are pruned while the codebook is kept. The
+results go to --out (default: pruned/); copy them over the files in src/
+to use them, and gen_vocab.py rebuilds the vocabulary tables on the next
+build.
+
+A report follows: how much of the sample the pruned vocabulary still
+covers, and what the dense layer and flash shrink by.
+"""
+
+import argparse
+import os
+import re
+from collections import Counter
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+SRC_DIR = os.path.join(os.path.dirname(TOOLS_DIR), "src")
+
+SPECIAL_TOKENS = 3       # <PAD>, <UNK>, <START>
+EMBEDDING_DIM = 64       # Must match DogberryAI_Word.h
+LSTM_UNITS = 256
+
+FLOAT_ARRAY = re.compile(
+    r"(?P<head>const\s+float\s+(?P<name>\w+)\s*\[)[^\]]*(?P<mid>\]\s*(?:PROGMEM\s*)?=\s*\{)"
+    r"(?P<body>.*?)(?P<tail>\};)", re.S)
+FLOAT_VALUE = re.compile(r"[-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?")
+BYTE_ARRAY = re.compile(
+    r"(?P<head>const\s+uint8_t\s+(?P<name>\w+)\s*\[)[^\]]*(?P<mid>\]\s*(?:PROGMEM\s*)?=\s*\{)"
+    r"(?P<body>.*?)(?P<tail>\};)", re.S)
+
+
+def read_vocab(path):
+    # Same parsing as gen_vocab.py
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    body = text[text.index("VOCAB_WORDS"):]
+    body = body[body.index("{") + 1:body.index("};")]
+    return [re.sub(r"\\(.)", r"\1", w) for w in re.findall(r'"((?:[^"\\]|\\.)*)"', body)]
+
+
+def write_vocab(path, words):
+    lines = [
+        "#ifndef VOCAB_DATA_H",
+        "#define VOCAB_DATA_H",
+        "",
+        "// Vocabulary configuration",
+        "#define VOCAB_SIZE %d" % len(words),
+        "#define SEQ_LENGTH 40",
+        "",
+        "// Word-to-index mapping",
+        "const char* VOCAB_WORDS[%d] = {" % len(words),
+    ]
+    for i, w in enumerate(words):
+        text = w.replace("\\", "\\\\").replace('"', '\\"')
+        comma = "," if i < len(words) - 1 else ""
+        lines.append('    "%s"%s  // %d' % (text, comma, i))
+    lines += ["};", "", "#endif // VOCAB_DATA_H", ""]
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+
+
+def tokenize(text):
+    # Close to DogberryAI_Word::tokenizeText: lowercased runs of letters
+    # and digits, punctuation as separate tokens, mentions and URLs dropped
+    text = re.sub(r"(?:@|https?://|www\.)\S*", " ", text.lower())
+    return re.findall(r"[0-9a-zÀ-ɏ]+|[^\w\s]", text)
+
+
+def format_floats(values):
+    lines = []
+    for start in range(0, len(values), 8):
+        lines.append("    " + ", ".join("%.8gf" % v for v in values[start:start + 8]) + ",")
+    return "\n" + "\n".join(lines) + "\n"
+
+
+def prune_weights(text, keep, old_size, prefix=""):
+    # prefix: "SMALL_" for the fast model's header, whose arrays and
+    # defines are all named that way
+    arrays = {}
+    for m in FLOAT_ARRAY.finditer(text):
+        arrays[m.group("name")] = m
+    for name in ("EMBEDDING_WEIGHTS", "DENSE_KERNEL", "DENSE_BIAS"):
+        if prefix + name not in arrays:
+            raise SystemExit("prune_vocab: %s not found in the weights header" % (prefix + name))
+    units = re.search(r"#define %sLSTM_UNITS (\d+)" % prefix, text)
+    units = int(units.group(1)) if units else LSTM_UNITS
+
+    def values(name):
+        return [float(v) for v in FLOAT_VALUE.findall(arrays[prefix + name].group("body"))]
+
+    embedding = values("EMBEDDING_WEIGHTS")
+    kernel = values("DENSE_KERNEL")
+    bias = values("DENSE_BIAS")
+    if (len(embedding) != old_size * EMBEDDING_DIM or len(kernel) != units * old_size
+            or len(bias) != old_size):
+        raise SystemExit("prune_vocab: %s weights do not match a %d-word vocabulary" % (
+            "fast model" if prefix else "model", old_size))
+
+    new_arrays = {
+        prefix + "EMBEDDING_WEIGHTS": [
+            v for i in keep for v in embedding[i * EMBEDDING_DIM:(i + 1) * EMBEDDING_DIM]],
+        # Keras layout: DENSE_KERNEL[j * vocab + i], so each word is a column
+        prefix + "DENSE_KERNEL": [kernel[j * old_size + i] for j in range(units) for i in keep],
+        prefix + "DENSE_BIAS": [bias[i] for i in keep],
+    }
+
+    def replace(m):
+        name = m.group("name")
+        if name not in new_arrays:
+            return m.group(0)
+        data = new_arrays[name]
+        return m.group("head") + str(len(data)) + m.group("mid") + format_floats(data) + m.group("tail")
+
+    text = FLOAT_ARRAY.sub(replace, text)
+    define = "#define %sMODEL_VOCAB_SIZE %d" % (prefix, len(keep))
+    if "#define %sMODEL_VOCAB_SIZE" % prefix in text:
+        text = re.sub(r"#define %sMODEL_VOCAB_SIZE \d+" % prefix, define, text)
+    else:
+        # After the include guard if there is one, else at the top
+        guard = re.search(r"#define \w+_H\s*\n", text)
+        at = guard.end() if guard else 0
+        text = text[:at] + "\n// Vocabulary entries, written by tools/prune_vocab.py\n" + define + "\n" + text[at:]
+    return text
+
+
+def prune_pq(text, keep, old_size):
+    # Each word's row of codes goes; the centroids stay valid as they are
+    subspaces = re.search(r"#define EMBEDDING_PQ_SUBSPACES (\d+)", text)
+    codes = [m for m in BYTE_ARRAY.finditer(text) if m.group("name") == "EMBEDDING_PQ_CODES"]
+    if not subspaces or not codes:
+        raise SystemExit("prune_vocab: EMBEDDING_PQ_CODES not found in the PQ header")
+    subspaces = int(subspaces.group(1))
+    values = [int(v) for v in re.findall(r"\d+", codes[0].group("body"))]
+    if len(values) != old_size * subspaces:
+        raise SystemExit("prune_vocab: PQ codes do not match a %d-word vocabulary" % old_size)
+
+    data = [v for i in keep for v in values[i * subspaces:(i + 1) * subspaces]]
+    lines = []
+    for start in range(0, len(data), 16):
+        lines.append("    " + ", ".join("%d" % v for v in data[start:start + 16]) + ",")
+    m = codes[0]
+    return (text[:m.start()] + m.group("head") + str(len(data)) + m.group("mid") +
+            "\n" + "\n".join(lines) + "\n" + m.group("tail") + text[m.end():])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--vocab", default=os.path.join(SRC_DIR, "vocab_data_word.h"))
+    parser.add_argument("--weights", default=os.path.join(SRC_DIR, "model_weights_word.h"))
+    parser.add_argument("--small", default=os.path.join(SRC_DIR, "model_weights_small.h"),
+                        help="fast model's weights header, pruned too if it exists")
+    parser.add_argument("--pq", default=os.path.join(SRC_DIR, "model_embedding_pq.h"),
+                        help="product-quantized embeddings, pruned too if they exist")
+    parser.add_argument("--out", default="pruned", help="directory for the pruned headers")
+    parser.add_argument("--deny", help="file of words to drop, one per line")
+    parser.add_argument("--sample", help="text file to count word frequencies in")
+    parser.add_argument("--min-count", type=int, default=0,
+                        help="drop words seen fewer times in the sample")
+    parser.add_argument("--keep", type=int, default=0,
+                        help="keep at most this many words, most frequent first")
+    args = parser.parse_args()
+
+    words = read_vocab(args.vocab)
+    ids = {w: i for i, w in enumerate(words)}
+    protected = set(range(SPECIAL_TOKENS)) | {i for i, w in enumerate(words)
+                                              if re.fullmatch(r"[^\w\s]", w)}
+
+    drop = {}  # id -> reason
+    if args.deny:
+        with open(args.deny, encoding="utf-8") as f:
+            for line in f:
+                word = line.split("#", 1)[0].strip().lower()
+                if word in ids and ids[word] not in protected:
+                    drop[ids[word]] = "denied"
+
+    counts = Counter()
+    if args.sample:
+        with open(args.sample, encoding="utf-8") as f:
+            for token in tokenize(f.read()):
+                if token in ids:
+                    counts[ids[token]] += 1
+        if args.min_count > 0:
+            for i in range(len(words)):
+                if i not in protected and i not in drop and counts[i] < args.min_count:
+                    drop[i] = "rare"
+    if args.keep > 0:
+        if not args.sample:
+            raise SystemExit("prune_vocab: --keep needs --sample")
+        ranked = sorted((i for i in range(len(words)) if i not in drop),
+                        key=lambda i: (i not in protected, -counts[i], i))
+        for i in ranked[args.keep:]:
+            if i not in protected:
+                drop[i] = "rare"
+
+    keep = [i for i in range(len(words)) if i not in drop]
+    kept_words = [words[i] for i in keep]
+
+    # Everything is pruned before anything is written, so a stale fast
+    # model or PQ export stops the run rather than leaving half a set of files
+    with open(args.weights, encoding="utf-8") as f:
+        pruned = {"model_weights_word.h": prune_weights(f.read(), keep, len(words))}
+    if os.path.exists(args.small):
+        with open(args.small, encoding="utf-8") as f:
+            pruned["model_weights_small.h"] = prune_weights(f.read(), keep, len(words), "SMALL_")
+    if os.path.exists(args.pq):
+        with open(args.pq, encoding="utf-8") as f:
+            pruned["model_embedding_pq.h"] = prune_pq(f.read(), keep, len(words))
+
+    os.makedirs(args.out, exist_ok=True)
+    write_vocab(os.path.join(args.out, "vocab_data_word.h"), kept_words)
+    for name, text in pruned.items():
+        with open(os.path.join(args.out, name), "w", encoding="utf-8") as f:
+            f.write(text)
+
+    # Report
+    old, new = len(words), len(keep)
+    print("Vocabulary: %d -> %d words (%d denied, %d rare)" % (
+        old, new, sum(1 for r in drop.values() if r == "denied"),
+        sum(1 for r in drop.values() if r == "rare")))
+    print("Dense layer: %d -> %d multiply-adds per token (%.2fx faster)" % (
+        LSTM_UNITS * old, LSTM_UNITS * new, old / float(new)))
+    saved = (old - new) * (EMBEDDING_DIM + LSTM_UNITS + 1) * 4
+    print("Flash: %d KB of weights saved" % (saved // 1024))
+    if args.sample:
+        total = sum(counts.values())
+        lost = sum(counts[i] for i in drop)
+        print("Sample coverage: %.2f%% of %d in-vocabulary tokens still representable "
+              "(%d occurrences now <UNK>)" % (100.0 * (total - lost) / max(total, 1), total, lost))
+        worst = sorted(drop, key=lambda i: -counts[i])[:10]
+        if worst and counts[worst[0]] > 0:
+            print("Most frequent dropped words: " + ", ".join(
+                "%s (%d)" % (words[i], counts[i]) for i in worst if counts[i] > 0))
+    print("Wrote %s" % os.path.abspath(args.out))
+
+
+if __name__ == "__main__":
+    main()